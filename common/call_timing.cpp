@@ -0,0 +1,318 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "call_timing.h"
+
+// Only these entry points are wrapped: what the zoo calls plus the usual hot
+// recording and submission calls.
+#define CALL_TIMING_INSTANCE_FUNCTIONS(X)                                      \
+  X(vkEnumeratePhysicalDevices)                                                \
+  X(vkEnumerateDeviceExtensionProperties)                                      \
+  X(vkGetPhysicalDeviceProperties)                                             \
+  X(vkGetPhysicalDeviceMemoryProperties)                                       \
+  X(vkGetPhysicalDeviceQueueFamilyProperties)                                  \
+  X(vkGetPhysicalDeviceFeatures2KHR)                                           \
+  X(vkCreateDevice)
+
+#define CALL_TIMING_DEVICE_FUNCTIONS(X)                                        \
+  X(vkGetDeviceQueue)                                                          \
+  X(vkDeviceWaitIdle)                                                          \
+  X(vkQueueSubmit)                                                             \
+  X(vkAllocateMemory)                                                          \
+  X(vkFreeMemory)                                                              \
+  X(vkMapMemory)                                                               \
+  X(vkUnmapMemory)                                                             \
+  X(vkGetImageMemoryRequirements)                                              \
+  X(vkBindImageMemory)                                                         \
+  X(vkCreateImage)                                                             \
+  X(vkDestroyImage)                                                            \
+  X(vkCreateImageView)                                                         \
+  X(vkDestroyImageView)                                                        \
+  X(vkCreateSampler)                                                           \
+  X(vkDestroySampler)                                                          \
+  X(vkCreateShaderModule)                                                      \
+  X(vkDestroyShaderModule)                                                     \
+  X(vkCreatePipelineCache)                                                     \
+  X(vkDestroyPipelineCache)                                                    \
+  X(vkGetPipelineCacheData)                                                    \
+  X(vkCreatePipelineLayout)                                                    \
+  X(vkCreateRenderPass)                                                        \
+  X(vkCreateGraphicsPipelines)                                                 \
+  X(vkDestroyPipeline)                                                         \
+  X(vkGetPipelineExecutablePropertiesKHR)                                      \
+  X(vkGetPipelineExecutableStatisticsKHR)                                      \
+  X(vkCreateDescriptorSetLayout)                                               \
+  X(vkDestroyDescriptorSetLayout)                                              \
+  X(vkCreateDescriptorPool)                                                    \
+  X(vkDestroyDescriptorPool)                                                   \
+  X(vkAllocateDescriptorSets)                                                  \
+  X(vkUpdateDescriptorSets)                                                    \
+  X(vkBeginCommandBuffer)                                                      \
+  X(vkEndCommandBuffer)                                                        \
+  X(vkCmdBindPipeline)                                                         \
+  X(vkCmdBindDescriptorSets)                                                   \
+  X(vkCmdDraw)
+
+enum CallTimingId : uint32_t {
+#define CALL_TIMING_ID(name) CallTiming_##name,
+  CALL_TIMING_INSTANCE_FUNCTIONS(CALL_TIMING_ID)
+  CALL_TIMING_DEVICE_FUNCTIONS(CALL_TIMING_ID)
+#undef CALL_TIMING_ID
+  CallTimingCount
+};
+
+static const char *callTimingNames[CallTimingCount] = {
+#define CALL_TIMING_NAME(name) #name,
+    CALL_TIMING_INSTANCE_FUNCTIONS(CALL_TIMING_NAME)
+    CALL_TIMING_DEVICE_FUNCTIONS(CALL_TIMING_NAME)
+#undef CALL_TIMING_NAME
+};
+
+// 16 linear buckets below 16 ticks, then 16 sub-buckets per power of two up
+// to 2^40 ticks: every bucket is within 1/16 of its value
+static const uint32_t HistogramSubBuckets = 16;
+static const uint32_t HistogramMaxExponent = 40;
+static const uint32_t HistogramBuckets =
+    HistogramSubBuckets + (HistogramMaxExponent - 3) * HistogramSubBuckets;
+
+struct CallHistograms {
+  // only the owning thread writes, relaxed atomics keep the exit dump defined
+  std::atomic<uint64_t> counts[CallTimingCount][HistogramBuckets];
+  std::atomic<uint64_t> totalTicks[CallTimingCount];
+  std::atomic<uint64_t> maxTicks[CallTimingCount];
+};
+
+// each entry point gets one wrapper per distinct original, so devices on
+// different drivers are each timed through their own pointer
+static const uint32_t MaxOriginals = 4;
+
+static std::atomic<bool> callTimingEnabled{false};
+// the real entry point behind each wrapper
+static std::atomic<void *> originals[MaxOriginals][CallTimingCount];
+// entries left unwrapped because every wrapper already had another original
+static std::atomic<uint32_t> mismatchedOriginals{0};
+
+static std::mutex histogramsMutex;
+static std::vector<CallHistograms *> allHistograms;
+static thread_local CallHistograms *threadHistograms = nullptr;
+
+static uint64_t startTicks;
+static std::chrono::steady_clock::time_point startTime;
+
+static inline uint64_t readTicks() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t ticks;
+  __asm__ volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+  return ticks;
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+}
+
+uint32_t histogramBucket(uint64_t ticks) {
+  if (ticks < HistogramSubBuckets)
+    return (uint32_t)ticks;
+  uint32_t exponent = 63 - (uint32_t)__builtin_clzll(ticks);
+  if (exponent > HistogramMaxExponent) {
+    exponent = HistogramMaxExponent;
+    ticks = (uint64_t)(HistogramSubBuckets * 2 - 1) << (HistogramMaxExponent - 4);
+  }
+  uint32_t sub = (uint32_t)(ticks >> (exponent - 4)) & (HistogramSubBuckets - 1);
+  return HistogramSubBuckets + (exponent - 4) * HistogramSubBuckets + sub;
+}
+
+// middle of the range a bucket covers
+double histogramBucketValue(uint32_t bucket) {
+  if (bucket < HistogramSubBuckets)
+    return bucket;
+  uint32_t exponent = (bucket - HistogramSubBuckets) / HistogramSubBuckets + 4;
+  uint32_t sub = (bucket - HistogramSubBuckets) % HistogramSubBuckets;
+  double width = (double)(1ull << (exponent - 4));
+  return (HistogramSubBuckets + sub) * width + width / 2;
+}
+
+static CallHistograms *registerThread() {
+  CallHistograms *histograms = new CallHistograms();
+  std::lock_guard<std::mutex> lock(histogramsMutex);
+  allHistograms.push_back(histograms);
+  threadHistograms = histograms;
+  return histograms;
+}
+
+static inline void recordCall(uint32_t id, uint64_t ticks) {
+  CallHistograms *histograms = threadHistograms;
+  if (!histograms)
+    histograms = registerThread();
+
+  std::atomic<uint64_t> &count = histograms->counts[id][histogramBucket(ticks)];
+  count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  std::atomic<uint64_t> &total = histograms->totalTicks[id];
+  total.store(total.load(std::memory_order_relaxed) + ticks, std::memory_order_relaxed);
+  std::atomic<uint64_t> &max = histograms->maxTicks[id];
+  if (ticks > max.load(std::memory_order_relaxed))
+    max.store(ticks, std::memory_order_relaxed);
+}
+
+template <uint32_t Id, uint32_t Index, typename Function> struct TimedCall;
+
+template <uint32_t Id, uint32_t Index, typename Result, typename... Args>
+struct TimedCall<Id, Index, Result(VKAPI_PTR *)(Args...)> {
+  typedef Result(VKAPI_PTR *Function)(Args...);
+
+  static Result VKAPI_CALL call(Args... args) {
+    Function original = (Function)originals[Index][Id].load(std::memory_order_relaxed);
+    uint64_t start = readTicks();
+    if constexpr (std::is_void<Result>::value) {
+      original(args...);
+      recordCall(Id, readTicks() - start);
+    } else {
+      Result result = original(args...);
+      recordCall(Id, readTicks() - start);
+      return result;
+    }
+  }
+};
+
+template <uint32_t Id, typename Function, uint32_t... Indices>
+static void wrapFunction(Function &function, std::integer_sequence<uint32_t, Indices...>) {
+  static const Function wrappers[] = {&TimedCall<Id, Indices, Function>::call...};
+  if (!function)
+    return;
+  for (Function wrapper : wrappers)
+    if (function == wrapper)
+      return;
+
+  for (uint32_t index = 0; index < MaxOriginals; index++) {
+    void *expected = nullptr;
+    if (originals[index][Id].compare_exchange_strong(expected, (void *)function) ||
+        expected == (void *)function) {
+      function = wrappers[index];
+      return;
+    }
+  }
+  mismatchedOriginals.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <uint32_t Id, typename Function> static void wrapFunction(Function &function) {
+  wrapFunction<Id>(function, std::make_integer_sequence<uint32_t, MaxOriginals>());
+}
+
+void enableCallTiming() {
+  bool expected = false;
+  if (!callTimingEnabled.compare_exchange_strong(expected, true))
+    return;
+
+  startTicks = readTicks();
+  startTime = std::chrono::steady_clock::now();
+  atexit(printCallTimings);
+}
+
+bool isCallTimingEnabled() {
+  return callTimingEnabled.load(std::memory_order_relaxed);
+}
+
+void wrapVolkGlobals() {
+  if (!isCallTimingEnabled())
+    return;
+#define CALL_TIMING_WRAP(name) wrapFunction<CallTiming_##name>(name);
+  CALL_TIMING_INSTANCE_FUNCTIONS(CALL_TIMING_WRAP)
+  CALL_TIMING_DEVICE_FUNCTIONS(CALL_TIMING_WRAP)
+#undef CALL_TIMING_WRAP
+}
+
+void wrapDeviceTable(VolkDeviceTable &table) {
+  if (!isCallTimingEnabled())
+    return;
+#define CALL_TIMING_WRAP(name) wrapFunction<CallTiming_##name>(table.name);
+  CALL_TIMING_DEVICE_FUNCTIONS(CALL_TIMING_WRAP)
+#undef CALL_TIMING_WRAP
+}
+
+void resetCallTimings() {
+  if (!isCallTimingEnabled())
+    return;
+
+  std::lock_guard<std::mutex> lock(histogramsMutex);
+  for (CallHistograms *histograms : allHistograms) {
+    for (uint32_t id = 0; id < CallTimingCount; id++) {
+      for (uint32_t bucket = 0; bucket < HistogramBuckets; bucket++)
+        histograms->counts[id][bucket].store(0, std::memory_order_relaxed);
+      histograms->totalTicks[id].store(0, std::memory_order_relaxed);
+      histograms->maxTicks[id].store(0, std::memory_order_relaxed);
+    }
+  }
+  startTicks = readTicks();
+  startTime = std::chrono::steady_clock::now();
+}
+
+void printCallTimings() {
+  if (!isCallTimingEnabled())
+    return;
+
+  double elapsedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+  uint64_t elapsedTicks = readTicks() - startTicks;
+  double nsPerTick = elapsedTicks ? elapsedNs / elapsedTicks : 1.0;
+
+  struct Row {
+    uint32_t id;
+    uint64_t calls;
+    uint64_t totalTicks;
+    uint64_t maxTicks;
+    std::vector<uint64_t> counts;
+  };
+  std::vector<Row> rows;
+  {
+    std::lock_guard<std::mutex> lock(histogramsMutex);
+    for (uint32_t id = 0; id < CallTimingCount; id++) {
+      Row row = {id, 0, 0, 0, std::vector<uint64_t>(HistogramBuckets)};
+      for (CallHistograms *histograms : allHistograms) {
+        for (uint32_t bucket = 0; bucket < HistogramBuckets; bucket++) {
+          uint64_t count = histograms->counts[id][bucket].load(std::memory_order_relaxed);
+          row.counts[bucket] += count;
+          row.calls += count;
+        }
+        row.totalTicks += histograms->totalTicks[id].load(std::memory_order_relaxed);
+        row.maxTicks = std::max(row.maxTicks, histograms->maxTicks[id].load(std::memory_order_relaxed));
+      }
+      if (row.calls)
+        rows.push_back(std::move(row));
+    }
+  }
+  std::sort(rows.begin(), rows.end(), [](const Row &a, const Row &b) { return a.totalTicks > b.totalTicks; });
+
+  auto percentile = [&](const Row &row, double fraction) {
+    uint64_t rank = (uint64_t)(fraction * (row.calls - 1));
+    uint64_t seen = 0;
+    for (uint32_t bucket = 0; bucket < HistogramBuckets; bucket++) {
+      seen += row.counts[bucket];
+      if (seen > rank)
+        return histogramBucketValue(bucket) * nsPerTick;
+    }
+    return row.maxTicks * nsPerTick;
+  };
+
+  printf("%-40s %10s %12s %10s %10s %10s %10s %12s\n", "entry point", "calls", "total ms",
+         "mean ns", "p50 ns", "p90 ns", "p99 ns", "max ns");
+  for (const Row &row : rows) {
+    printf("%-40s %10llu %12.3f %10.0f %10.0f %10.0f %10.0f %12.0f\n", callTimingNames[row.id],
+           (unsigned long long)row.calls, row.totalTicks * nsPerTick / 1e6,
+           row.totalTicks * nsPerTick / row.calls, percentile(row, 0.5), percentile(row, 0.9),
+           percentile(row, 0.99), row.maxTicks * nsPerTick);
+  }
+  if (mismatchedOriginals.load())
+    printf("%u entry points left untimed: more than %u drivers resolved them\n",
+           mismatchedOriginals.load(), MaxOriginals);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "volk/volk.h"
+
+// Opt-in per-entry-point call timing. Wrapping swaps the function pointers in
+// volk's globals or in a VolkDeviceTable for thin wrappers that time the call
+// with the CPU tick counter and count it into a per-thread log-linear
+// histogram; nothing is touched unless enableCallTiming was called. Devices
+// whose drivers resolve an entry point differently get separate wrappers. The
+// merged histograms are printed at exit.
+
+// idempotent; registers the exit-time dump
+void enableCallTiming();
+bool isCallTimingEnabled();
+// call after volkLoadInstance/volkLoadInstanceOnly or volkLoadDevice
+void wrapVolkGlobals();
+// call after volkLoadDeviceTable
+void wrapDeviceTable(VolkDeviceTable &table);
+// zeroes what has been recorded so far; a forked child calls it so its dump
+// covers only its own calls
+void resetCallTimings();
+void printCallTimings();
+
+// histogram bucket a call of `ticks` lands in, and the value a bucket reports;
+// every bucket is within 1/16 of the ticks it holds
+uint32_t histogramBucket(uint64_t ticks);
+double histogramBucketValue(uint32_t bucket);
@@ -0,0 +1,250 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include "canary.h"
+#include "mutation.h"
+
+struct CanaryField {
+  const char *name;
+  void (*fill)(PipelineState &state, uint32_t canary);
+};
+
+static void fillStencilOpState(VkStencilOpState &stencil, uint32_t canary) {
+  if (canary == 0) {
+    stencil.failOp = VK_STENCIL_OP_INCREMENT_AND_WRAP;
+    stencil.passOp = VK_STENCIL_OP_DECREMENT_AND_WRAP;
+    stencil.depthFailOp = VK_STENCIL_OP_INVERT;
+    stencil.compareOp = VK_COMPARE_OP_GREATER_OR_EQUAL;
+    stencil.compareMask = 0xA5A5A5A5;
+    stencil.writeMask = 0x5A5A5A5A;
+    stencil.reference = 0x3C3C3C3C;
+  } else {
+    stencil.failOp = VK_STENCIL_OP_REPLACE;
+    stencil.passOp = VK_STENCIL_OP_INCREMENT_AND_CLAMP;
+    stencil.depthFailOp = VK_STENCIL_OP_ZERO;
+    stencil.compareOp = VK_COMPARE_OP_LESS;
+    stencil.compareMask = 0x5A5A5A5A;
+    stencil.writeMask = 0xA5A5A5A5;
+    stencil.reference = 0xC3C3C3C3;
+  }
+}
+
+// only valid values go in, the spec still requires valid enums for ignored
+// by-value state; no CONSTANT or SRC1 blend factors so no other state comes
+// into play
+static const CanaryField canaryFields[] = {
+  // stencilTestEnable is VK_FALSE
+  {"pDepthStencilState->front/back",
+   [](PipelineState &s, uint32_t canary) {
+     fillStencilOpState(s.depthStencilStateCreateInfo.front, canary);
+     fillStencilOpState(s.depthStencilStateCreateInfo.back, canary);
+   }},
+  // depthTestEnable is VK_FALSE
+  {"pDepthStencilState->depthCompareOp",
+   [](PipelineState &s, uint32_t canary) {
+     s.depthStencilStateCreateInfo.depthCompareOp =
+         canary == 0 ? VK_COMPARE_OP_GREATER : VK_COMPARE_OP_NOT_EQUAL;
+   }},
+  // depthBoundsTestEnable is VK_FALSE
+  {"pDepthStencilState->minDepthBounds/maxDepthBounds",
+   [](PipelineState &s, uint32_t canary) {
+     s.depthStencilStateCreateInfo.minDepthBounds = canary == 0 ? 0.25f : 0.125f;
+     s.depthStencilStateCreateInfo.maxDepthBounds = canary == 0 ? 0.75f : 0.875f;
+   }},
+  // blendEnable is VK_FALSE
+  {"pColorBlendState->pAttachments[0] blend factors/ops",
+   [](PipelineState &s, uint32_t canary) {
+     VkPipelineColorBlendAttachmentState &attachment = s.colourBlendAttachmentState;
+     attachment.srcColorBlendFactor = canary == 0 ? VK_BLEND_FACTOR_SRC_ALPHA : VK_BLEND_FACTOR_DST_COLOR;
+     attachment.dstColorBlendFactor = canary == 0 ? VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA : VK_BLEND_FACTOR_SRC_COLOR;
+     attachment.colorBlendOp = canary == 0 ? VK_BLEND_OP_SUBTRACT : VK_BLEND_OP_REVERSE_SUBTRACT;
+     attachment.srcAlphaBlendFactor = canary == 0 ? VK_BLEND_FACTOR_ONE : VK_BLEND_FACTOR_DST_ALPHA;
+     attachment.dstAlphaBlendFactor = canary == 0 ? VK_BLEND_FACTOR_ONE_MINUS_DST_ALPHA : VK_BLEND_FACTOR_ONE;
+     attachment.alphaBlendOp = canary == 0 ? VK_BLEND_OP_MAX : VK_BLEND_OP_MIN;
+   }},
+  // no blend factor references the constants
+  {"pColorBlendState->blendConstants",
+   [](PipelineState &s, uint32_t canary) {
+     for (uint32_t i = 0; i < 4; ++i)
+       s.colourBlendStateCreateInfo.blendConstants[i] =
+           canary == 0 ? 0.25f * (i + 1) : 1.0f - 0.25f * i;
+   }},
+  // logicOpEnable is VK_FALSE
+  {"pColorBlendState->logicOp",
+   [](PipelineState &s, uint32_t canary) {
+     s.colourBlendStateCreateInfo.logicOp = canary == 0 ? VK_LOGIC_OP_XOR : VK_LOGIC_OP_NAND;
+   }},
+  // depthBiasEnable is VK_FALSE
+  {"pRasterizationState->depthBias*",
+   [](PipelineState &s, uint32_t canary) {
+     s.rasterStateCreateInfo.depthBiasConstantFactor = canary == 0 ? 1.5f : -3.0f;
+     s.rasterStateCreateInfo.depthBiasClamp = canary == 0 ? 0.5f : -0.25f;
+     s.rasterStateCreateInfo.depthBiasSlopeFactor = canary == 0 ? 2.0f : -1.0f;
+   }},
+  // sampleShadingEnable is VK_FALSE
+  {"pMultisampleState->minSampleShading",
+   [](PipelineState &s, uint32_t canary) {
+     s.multisampleStateCreateInfo.minSampleShading = canary == 0 ? 0.5f : 1.0f;
+   }},
+};
+
+struct CanaryJob {
+  std::unique_ptr<PipelineState> state;
+  std::string cacheBlob;
+  std::string statistics;
+};
+
+static std::string getExecutableStatistics(Context &context, VkPipeline pipeline) {
+  std::string statistics;
+
+  VkPipelineInfoKHR pipelineInfo;
+  pipelineInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_INFO_KHR;
+  pipelineInfo.pNext = nullptr;
+  pipelineInfo.pipeline = pipeline;
+
+  uint32_t executableCount = 0;
+  VULKAN_CHECK(context.deviceTable.vkGetPipelineExecutablePropertiesKHR(
+      context.device, &pipelineInfo, &executableCount, nullptr));
+
+  for (uint32_t i = 0; i < executableCount; ++i) {
+    VkPipelineExecutableInfoKHR executableInfo;
+    executableInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INFO_KHR;
+    executableInfo.pNext = nullptr;
+    executableInfo.pipeline = pipeline;
+    executableInfo.executableIndex = i;
+
+    uint32_t statisticCount = 0;
+    VULKAN_CHECK(context.deviceTable.vkGetPipelineExecutableStatisticsKHR(
+        context.device, &executableInfo, &statisticCount, nullptr));
+    std::vector<VkPipelineExecutableStatisticKHR> executableStatistics(statisticCount);
+    for (VkPipelineExecutableStatisticKHR &statistic : executableStatistics) {
+      statistic.sType = VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_STATISTIC_KHR;
+      statistic.pNext = nullptr;
+    }
+    VULKAN_CHECK(context.deviceTable.vkGetPipelineExecutableStatisticsKHR(
+        context.device, &executableInfo, &statisticCount, executableStatistics.data()));
+
+    for (const VkPipelineExecutableStatisticKHR &statistic : executableStatistics) {
+      statistics += statistic.name;
+      statistics.append((const char *)&statistic.format, sizeof(statistic.format));
+      statistics.append((const char *)&statistic.value, sizeof(statistic.value));
+    }
+  }
+  return statistics;
+}
+
+static void compileCanaryJob(Context &context, CanaryJob &job) {
+  VkPipelineCacheCreateInfo cacheCreateInfo;
+  cacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+  cacheCreateInfo.flags = 0;
+  cacheCreateInfo.pNext = nullptr;
+  cacheCreateInfo.initialDataSize = 0;
+  cacheCreateInfo.pInitialData = nullptr;
+
+  VkPipelineCache cache;
+  VULKAN_CHECK(context.deviceTable.vkCreatePipelineCache(context.device, &cacheCreateInfo,
+                                                         context.allocationCallbacks, &cache));
+
+  VkGraphicsPipelineCreateInfo createInfo = job.state->createInfo;
+  if (context.pipelineExecutableProperties)
+    createInfo.flags |= VK_PIPELINE_CREATE_CAPTURE_STATISTICS_BIT_KHR;
+
+  VkPipeline pipeline;
+  VULKAN_CHECK(context.deviceTable.vkCreateGraphicsPipelines(
+      context.device, cache, 1, &createInfo, context.allocationCallbacks, &pipeline));
+
+  size_t size = 0;
+  VULKAN_CHECK(context.deviceTable.vkGetPipelineCacheData(context.device, cache,
+                                                          &size, nullptr));
+  job.cacheBlob.resize(size);
+  VULKAN_CHECK(context.deviceTable.vkGetPipelineCacheData(context.device, cache,
+                                                          &size, &job.cacheBlob[0]));
+
+  if (context.pipelineExecutableProperties)
+    job.statistics = getExecutableStatistics(context, pipeline);
+
+  context.deviceTable.vkDestroyPipeline(context.device, pipeline, context.allocationCallbacks);
+  context.deviceTable.vkDestroyPipelineCache(context.device, cache, context.allocationCallbacks);
+}
+
+static CanaryJob &addJob(Context &context, std::vector<CanaryJob> &jobs,
+                         int field, uint32_t canary) {
+  jobs.emplace_back();
+  CanaryJob &job = jobs.back();
+  job.state.reset(new PipelineState);
+  initializePipelineState(context, *job.state);
+  for (uint32_t i = 0; i < std::size(canaryFields); ++i) {
+    if (field < 0 || (uint32_t)field == i)
+      canaryFields[i].fill(*job.state, canary);
+  }
+  return job;
+}
+
+static CanaryResult compareJobs(Context &context, const char *name,
+                                const CanaryJob &a, const CanaryJob &b) {
+  CanaryResult result;
+  result.name = name;
+  result.cacheDiffers = a.cacheBlob != b.cacheBlob;
+  result.statisticsAvailable = context.pipelineExecutableProperties;
+  result.statisticsDiffer = a.statistics != b.statistics;
+  return result;
+}
+
+CanaryReport runCanaryProbes(Context &context, uint32_t threadCount) {
+  std::vector<CanaryJob> jobs;
+  jobs.reserve(3 + 2 * std::size(canaryFields));
+
+  // every field with canary 0, then 1, then 0 again as a determinism control
+  addJob(context, jobs, -1, 0);
+  addJob(context, jobs, -1, 1);
+  addJob(context, jobs, -1, 0);
+  for (uint32_t i = 0; i < std::size(canaryFields); ++i) {
+    addJob(context, jobs, (int)i, 0);
+    addJob(context, jobs, (int)i, 1);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::atomic<size_t> next(0);
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < std::max(1u, threadCount); ++t) {
+    threads.emplace_back([&]() {
+      for (size_t i = next++; i < jobs.size(); i = next++)
+        compileCanaryJob(context, jobs[i]);
+    });
+  }
+  for (std::thread &thread : threads)
+    thread.join();
+
+  CanaryReport report;
+  report.wallTimeMs = std::chrono::duration<double, std::milli>(
+                          std::chrono::steady_clock::now() - start).count();
+  report.cacheNondeterministic = jobs[0].cacheBlob != jobs[2].cacheBlob ||
+                                 jobs[0].statistics != jobs[2].statistics;
+
+  report.results.push_back(compareJobs(context, "all", jobs[0], jobs[1]));
+  for (uint32_t i = 0; i < std::size(canaryFields); ++i)
+    report.results.push_back(
+        compareJobs(context, canaryFields[i].name, jobs[3 + 2 * i], jobs[4 + 2 * i]));
+  return report;
+}
+
+void printCanaryReport(const CanaryReport &report) {
+  if (report.cacheNondeterministic)
+    printf("canary: identical state compiled to different output, results are unreliable\n");
+
+  for (const CanaryResult &result : report.results) {
+    bool affected = result.cacheDiffers || result.statisticsDiffer;
+    printf("canary: %s %s (cache %s, statistics %s)\n", result.name,
+           affected ? "AFFECTS OUTPUT" : "ignored",
+           result.cacheDiffers ? "differs" : "same",
+           !result.statisticsAvailable ? "unavailable"
+           : result.statisticsDiffer   ? "differ"
+                                       : "same");
+  }
+  printf("canary: %zu compiles in %.3f ms\n", 3 + 2 * (report.results.size() - 1),
+         report.wallTimeMs);
+}
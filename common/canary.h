@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+#include "common.h"
+
+// Canary detector for ignored state that is passed by value (stencil ops with
+// stencil testing off, blend factors with blending off, ...). Each field is
+// filled with two different valid canary values and compiled once with each;
+// if the pipeline cache blob or the executable statistics differ, the driver
+// consumed state the spec says it ignores.
+
+struct CanaryResult {
+  // "all" for every field at once, otherwise the single field that differed
+  const char *name;
+  bool cacheDiffers = false;
+  bool statisticsAvailable = false;
+  bool statisticsDiffer = false;
+};
+
+struct CanaryReport {
+  std::vector<CanaryResult> results;
+  // two compiles of identical state produced different cache blobs, so cache
+  // comparisons are meaningless on this driver
+  bool cacheNondeterministic = false;
+  double wallTimeMs = 0.0;
+};
+
+CanaryReport runCanaryProbes(Context &context, uint32_t threadCount);
+void printCanaryReport(const CanaryReport &report);
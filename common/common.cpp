@@ -1,17 +1,125 @@
+#include <ctype.h>
+#include <fcntl.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
 #include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
+#include "call_timing.h"
 #include "common.h"
+#include "embedded_spirv.h"
+
+// ~/Library/Caches on macOS, $XDG_CACHE_HOME or ~/.cache elsewhere; the
+// working directory when there is no home to put it in
+static std::string getDefaultPipelineCachePath()
+{
+  std::string directory;
+#if defined(__APPLE__)
+  if (const char *home = getenv("HOME"))
+    directory = std::string(home) + "/Library/Caches";
+#else
+  if (const char *cacheHome = getenv("XDG_CACHE_HOME"))
+    directory = cacheHome;
+  else if (const char *home = getenv("HOME"))
+    directory = std::string(home) + "/.cache";
+#endif
+  if (directory.empty())
+    return "vk_parameter_zoo.pipelinecache";
+  return directory + "/vk_parameter_zoo/pipelinecache";
+}
 
 Context::Context(int argc, const char *argv[])
 {
   enableValidationLayers = false;
+  pipelineCachePath = getDefaultPipelineCachePath();
   for (int i = 0; i < argc; ++i)
   {
     if (strcmp(argv[i], "--debug") == 0)
     {
       enableValidationLayers = true;
     }
+    else if (strcmp(argv[i], "--cocoa") == 0)
+    {
+      surfaceMode = SurfaceMode::Cocoa;
+      commandLineRequirements |= RequireSurface;
+    }
+    else if (strcmp(argv[i], "--headless") == 0)
+    {
+      surfaceMode = SurfaceMode::Headless;
+      commandLineRequirements |= RequireSurface;
+    }
+    else if (strcmp(argv[i], "--no-surface") == 0)
+    {
+      surfaceMode = SurfaceMode::None;
+      commandLineRequirements &= ~RequireSurface;
+    }
+    else if (strncmp(argv[i], "--shader-dir=", 13) == 0)
+    {
+      shaderDirectory = argv[i] + 13;
+    }
+    else if (strcmp(argv[i], "--guard-pages") == 0)
+    {
+      guardPages = true;
+    }
+    else if (strcmp(argv[i], "--cold-cache") == 0)
+    {
+      coldPipelineCache = true;
+    }
+    else if (strncmp(argv[i], "--pipeline-cache=", 17) == 0)
+    {
+      pipelineCachePath = argv[i] + 17;
+    }
+    else if (strcmp(argv[i], "--host-allocator") == 0)
+    {
+      hostAllocatorEnabled = true;
+    }
+    else if (strcmp(argv[i], "--host-arena") == 0)
+    {
+      hostAllocatorEnabled = true;
+      hostArena = true;
+    }
+    else if (strcmp(argv[i], "--profile-calls") == 0)
+    {
+      profileCalls = true;
+    }
+    else if (strcmp(argv[i], "--lazy-volk") == 0)
+    {
+      lazyVolk = true;
+    }
+    else if (strncmp(argv[i], "--icd=", 6) == 0)
+    {
+      icdPath = argv[i] + 6;
+    }
+    else if (strncmp(argv[i], "--device=", 9) == 0)
+    {
+      deviceName = argv[i] + 9;
+    }
+    else if (strncmp(argv[i], "--device-uuid=", 14) == 0)
+    {
+      deviceUuid = argv[i] + 14;
+    }
+    else if (strcmp(argv[i], "--device-policy=first") == 0)
+    {
+      devicePolicy = DevicePolicy::First;
+    }
+    else if (strcmp(argv[i], "--device-policy=performance") == 0)
+    {
+      devicePolicy = DevicePolicy::Performance;
+    }
+    else if (strcmp(argv[i], "--device-policy=software") == 0)
+    {
+      devicePolicy = DevicePolicy::Software;
+    }
+    else if (strncmp(argv[i], "--startup-trace=", 16) == 0)
+    {
+      startupTracePath = argv[i] + 16;
+    }
   }
 }
 
@@ -87,63 +195,209 @@ void VULKAN_CHECK(VkResult result) {
 }
 
 static void createSurface(Context &context) {
-  VkMetalSurfaceCreateInfoEXT createInfo;
-  createInfo.sType = VK_STRUCTURE_TYPE_METAL_SURFACE_CREATE_INFO_EXT;
-  createInfo.pLayer = cocoa_windowGetLayer(context.cocoaWindow);
-  createInfo.flags = 0;
-  createInfo.pNext = nullptr;
+  switch (context.surfaceMode) {
+  case SurfaceMode::Cocoa: {
+#if defined(VK_USE_PLATFORM_METAL_EXT)
+    VkMetalSurfaceCreateInfoEXT createInfo;
+    createInfo.sType = VK_STRUCTURE_TYPE_METAL_SURFACE_CREATE_INFO_EXT;
+    createInfo.pLayer = cocoa_windowGetLayer(context.cocoaWindow);
+    createInfo.flags = 0;
+    createInfo.pNext = nullptr;
+
+    VULKAN_CHECK(vkCreateMetalSurfaceEXT(context.instance, &createInfo, context.allocationCallbacks,
+                                         &context.surface));
+#else
+    fprintf(stderr, "ERROR Cocoa surfaces are not supported in this build\n");
+    abort();
+#endif
+    break;
+  }
+  case SurfaceMode::Headless: {
+    VkHeadlessSurfaceCreateInfoEXT createInfo;
+    createInfo.sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT;
+    createInfo.flags = 0;
+    createInfo.pNext = nullptr;
 
-  VULKAN_CHECK(vkCreateMetalSurfaceEXT(context.instance, &createInfo, nullptr,
-                                       &context.surface));
+    VULKAN_CHECK(vkCreateHeadlessSurfaceEXT(context.instance, &createInfo,
+                                            context.allocationCallbacks, &context.surface));
+    break;
+  }
+  case SurfaceMode::None:
+    break;
+  }
 }
 
-static VkShaderModule createShaderModule(Context &context, const char *path) {
-  std::ifstream file(path, std::ios::binary);
-  if (!file.is_open()) {
-    fprintf(stderr, "ERROR opening file '%s'\n", path);
-    abort();
+static bool hasDeviceExtension(Context &context, const char *name) {
+  uint32_t count = 0;
+  VULKAN_CHECK(vkEnumerateDeviceExtensionProperties(context.physicalDevice,
+                                                    nullptr, &count, nullptr));
+  std::vector<VkExtensionProperties> properties(count);
+  VULKAN_CHECK(vkEnumerateDeviceExtensionProperties(
+      context.physicalDevice, nullptr, &count, properties.data()));
+
+  for (const VkExtensionProperties &property : properties) {
+    if (strcmp(property.extensionName, name) == 0)
+      return true;
   }
+  return false;
+}
 
-  file.seekg(0, std::ios_base::end);
-  size_t fileSizeInBytes = file.tellg();
-  auto buffer = new uint32_t[fileSizeInBytes / 4];
-  file.seekg(0, std::ios_base::beg);
-  file.read((char *)buffer, fileSizeInBytes);
-  file.close();
+static const uint32_t SpvMagicNumber = 0x07230203;
 
+VkShaderModule createShaderModule(Context &context, const uint32_t *code,
+                                  size_t codeSize) {
   VkShaderModuleCreateInfo createInfo;
   createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
   createInfo.flags = 0;
   createInfo.pNext = nullptr;
-  createInfo.codeSize = fileSizeInBytes;
-  createInfo.pCode = buffer;
+  createInfo.codeSize = codeSize;
+  createInfo.pCode = code;
 
   VkShaderModule shaderModule;
-  VULKAN_CHECK(vkCreateShaderModule(context.device, &createInfo, nullptr,
-                                    &shaderModule));
+  VULKAN_CHECK(context.deviceTable.vkCreateShaderModule(
+      context.device, &createInfo, context.allocationCallbacks, &shaderModule));
+  return shaderModule;
+}
+
+VkShaderModule createShaderModule(Context &context, const char *path) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    fprintf(stderr, "ERROR opening file '%s'\n", path);
+    abort();
+  }
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0) {
+    fprintf(stderr, "ERROR reading file '%s'\n", path);
+    abort();
+  }
+  size_t fileSizeInBytes = (size_t)fileStat.st_size;
+
+  // the driver consumes the mapping directly, so no copy and nothing to free
+  // beyond the mapping itself
+  void *mapping = fileSizeInBytes > 0
+                      ? mmap(nullptr, fileSizeInBytes, PROT_READ, MAP_PRIVATE, fd, 0)
+                      : MAP_FAILED;
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    fprintf(stderr, "ERROR mapping file '%s'\n", path);
+    abort();
+  }
+
+  const uint32_t *code = (const uint32_t *)mapping;
+  if (((uintptr_t)code % alignof(uint32_t)) != 0 ||
+      fileSizeInBytes % sizeof(uint32_t) != 0 || code[0] != SpvMagicNumber) {
+    fprintf(stderr, "ERROR '%s' is not a valid SPIR-V module\n", path);
+    abort();
+  }
+
+  VkShaderModule shaderModule =
+      createShaderModule(context, code, fileSizeInBytes);
 
+  munmap(mapping, fileSizeInBytes);
   return shaderModule;
 }
 
+// volk's loader and instance-level pointers are process globals shared by every
+// Context, so they're loaded once per process, by the first instance. Instance-level
+// entry points dispatch on their handle (loader trampolines, or the driver's own with
+// --icd), so they serve later instances too. Device-level calls only ever go through
+// Context::deviceTable.
+static std::mutex volkGlobalsMutex;
+static pid_t volkInitializedPid = 0;
+static pid_t volkInstanceLoadedPid = 0;
+
+static void initializeVolk(Context &context) {
+  std::lock_guard<std::mutex> lock(volkGlobalsMutex);
+  if (volkInitializedPid == getpid())
+    return;
+
+  StartupPhaseScope phase(context.startupPhases, "volkInitialize");
+  if (context.icdPath.empty()) {
+    VULKAN_CHECK(volkInitialize());
+  } else {
+    printf("Loading ICD %s without the Vulkan loader.\n", context.icdPath.c_str());
+    VULKAN_CHECK(volkInitializeFromICD(context.icdPath.c_str()));
+  }
+  volkInitializedPid = getpid();
+}
+
+static void loadVolkInstance(Context &context) {
+  std::lock_guard<std::mutex> lock(volkGlobalsMutex);
+  if (volkInstanceLoadedPid == getpid())
+    return;
+
+  StartupPhaseScope phase(context.startupPhases, "volkLoadInstance");
+  // call timing wraps resolved pointers, so profiling always loads eagerly
+  if (context.lazyVolk && !context.profileCalls)
+    volkLoadInstanceOnlyLazy(context.instance);
+  else
+    volkLoadInstanceOnly(context.instance);
+  if (context.profileCalls) {
+    enableCallTiming();
+    wrapVolkGlobals();
+  }
+  volkInstanceLoadedPid = getpid();
+}
+
 static void createVkInstance(Context &context) {
+  if (!context.icdPath.empty() && context.enableValidationLayers) {
+    fprintf(stderr, "ERROR --debug needs the Vulkan loader for its layer, it can't be combined with --icd\n");
+    abort();
+  }
 
-  VULKAN_CHECK(volkInitialize());
+  initializeVolk(context);
+
+  if (context.enableValidationLayers) {
+    // only validation needs the layer list, and only to fail early
+    StartupPhaseScope phase(context.startupPhases, "enumerateLayers");
+    uint32_t countAllLayers = 0;
+    VULKAN_CHECK(vkEnumerateInstanceLayerProperties(&countAllLayers, nullptr));
+    std::vector<VkLayerProperties> availInstLayers(countAllLayers);
+    VULKAN_CHECK(vkEnumerateInstanceLayerProperties(&countAllLayers, availInstLayers.data()));
+
+    bool found = false;
+    for (const VkLayerProperties &layer : availInstLayers)
+      found = found || strcmp(layer.layerName, "VK_LAYER_KHRONOS_validation") == 0;
+    if (!found) {
+      fprintf(stderr, "ERROR VK_LAYER_KHRONOS_validation is not installed\n");
+      abort();
+    }
+  }
 
-  uint32_t countAllLayers = 0;
-  VULKAN_CHECK(vkEnumerateInstanceLayerProperties(&countAllLayers, nullptr));
-  std::vector<VkLayerProperties> availInstLayers(countAllLayers);
-  VULKAN_CHECK(vkEnumerateInstanceLayerProperties(&countAllLayers, availInstLayers.data()));
-  
-  for (auto i = 0; i < countAllLayers; ++i)
-    printf("'%s':%d\n", availInstLayers[i].layerName, availInstLayers[i].implementationVersion);
-  
   printf("Initializing vulkan instance.\n");
 
-  const char *extensions[] = {
-    VK_KHR_SURFACE_EXTENSION_NAME,
-    VK_EXT_METAL_SURFACE_EXTENSION_NAME,
+  std::vector<const char *> extensions = {
     "VK_KHR_get_physical_device_properties2",
   };
+  // VkPhysicalDeviceIDProperties, only needed to match --device-uuid or for
+  // runFanOut to read the UUIDs the other Contexts select by
+  if (!context.deviceUuid.empty() || context.physicalDeviceIndex >= 0)
+    extensions.push_back("VK_KHR_external_memory_capabilities");
+  switch (context.surfaceMode) {
+  case SurfaceMode::Cocoa:
+    extensions.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
+    extensions.push_back("VK_EXT_metal_surface");
+    break;
+  case SurfaceMode::Headless:
+    extensions.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
+    extensions.push_back(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME);
+    break;
+  case SurfaceMode::None:
+    break;
+  }
+
+  if (context.hostAllocatorEnabled) {
+    context.hostAllocator = createHostAllocator(context.hostArena);
+    context.allocationCallbacks = &context.hostAllocator->callbacks;
+  }
+
+  VkDebugUtilsMessengerCreateInfoEXT messengerCreateInfo = {};
+  if (context.enableValidationLayers) {
+    context.validationLog = createValidationLog();
+    messengerCreateInfo = getValidationMessengerCreateInfo(context.validationLog);
+    extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+  }
 
   VkApplicationInfo app;
   app.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
@@ -162,17 +416,135 @@ static void createVkInstance(Context &context) {
   VkInstanceCreateInfo instanceCreateInfo;
   instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
   instanceCreateInfo.flags = 0;
-  instanceCreateInfo.pNext = nullptr;
+  // also captures messages from vkCreateInstance itself
+  instanceCreateInfo.pNext = context.enableValidationLayers ? &messengerCreateInfo : nullptr;
   instanceCreateInfo.pApplicationInfo = &app;
-  instanceCreateInfo.enabledExtensionCount = std::size(extensions);
-  instanceCreateInfo.ppEnabledExtensionNames = extensions;
+  instanceCreateInfo.enabledExtensionCount = (uint32_t)extensions.size();
+  instanceCreateInfo.ppEnabledExtensionNames = extensions.data();
   instanceCreateInfo.enabledLayerCount = context.enableValidationLayers ? 1 : 0;
   instanceCreateInfo.ppEnabledLayerNames = context.enableValidationLayers ? layers : nullptr;
 
-  VULKAN_CHECK(
-      vkCreateInstance(&instanceCreateInfo, nullptr, &context.instance));
+  {
+    StartupPhaseScope phase(context.startupPhases, "vkCreateInstance");
+    VULKAN_CHECK(
+        vkCreateInstance(&instanceCreateInfo, context.allocationCallbacks, &context.instance));
+  }
+
+  loadVolkInstance(context);
 
-  volkLoadInstance(context.instance);
+  if (context.enableValidationLayers) {
+    StartupPhaseScope phase(context.startupPhases, "vkCreateDebugUtilsMessengerEXT");
+    VULKAN_CHECK(vkCreateDebugUtilsMessengerEXT(context.instance, &messengerCreateInfo,
+                                                context.allocationCallbacks, &context.debugMessenger));
+  }
+}
+
+static const char *physicalDeviceTypeToString(VkPhysicalDeviceType type) {
+  switch (type) {
+  case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU:
+    return "integrated";
+  case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU:
+    return "discrete";
+  case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU:
+    return "virtual";
+  case VK_PHYSICAL_DEVICE_TYPE_CPU:
+    return "cpu";
+  default:
+    return "other";
+  }
+}
+
+// lower case hex without dashes, the form --device-uuid is compared in
+std::string getPhysicalDeviceUuid(VkPhysicalDevice physicalDevice) {
+  VkPhysicalDeviceIDPropertiesKHR idProperties = {};
+  idProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES_KHR;
+  VkPhysicalDeviceProperties2KHR properties = {};
+  properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR;
+  properties.pNext = &idProperties;
+  vkGetPhysicalDeviceProperties2KHR(physicalDevice, &properties);
+
+  std::string uuid;
+  char digits[3];
+  for (uint32_t i = 0; i < VK_UUID_SIZE; ++i) {
+    snprintf(digits, sizeof(digits), "%02x", idProperties.deviceUUID[i]);
+    uuid += digits;
+  }
+  return uuid;
+}
+
+uint32_t getThreadBudget(const Context &context) {
+  if (context.threadBudget > 0)
+    return context.threadBudget;
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// higher is better, ties go to the earlier device
+static int scorePhysicalDevice(DevicePolicy policy, VkPhysicalDeviceType type) {
+  switch (policy) {
+  case DevicePolicy::First:
+    return 0;
+  case DevicePolicy::Performance:
+    switch (type) {
+    case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU:
+      return 4;
+    case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU:
+      return 3;
+    case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU:
+      return 2;
+    case VK_PHYSICAL_DEVICE_TYPE_CPU:
+      return 1;
+    default:
+      return 0;
+    }
+  case DevicePolicy::Software:
+    return type == VK_PHYSICAL_DEVICE_TYPE_CPU ? 1 : 0;
+  }
+  return 0;
+}
+
+static uint32_t selectPhysicalDevice(Context &context,
+                                     const std::vector<VkPhysicalDevice> &physicalDevices) {
+  std::vector<VkPhysicalDeviceProperties> properties(physicalDevices.size());
+  for (size_t i = 0; i < physicalDevices.size(); ++i)
+    vkGetPhysicalDeviceProperties(physicalDevices[i], &properties[i]);
+
+  std::string uuid;
+  for (char c : context.deviceUuid) {
+    if (c != '-')
+      uuid += (char)tolower((unsigned char)c);
+  }
+
+  int32_t selected = -1;
+  int bestScore = -1;
+  for (uint32_t i = 0; i < physicalDevices.size(); ++i) {
+    bool matches;
+    if (context.physicalDeviceIndex >= 0)
+      matches = (int32_t)i == context.physicalDeviceIndex;
+    else if (!uuid.empty())
+      matches = getPhysicalDeviceUuid(physicalDevices[i]) == uuid;
+    else if (!context.deviceName.empty())
+      matches = strstr(properties[i].deviceName, context.deviceName.c_str()) != nullptr;
+    else
+      matches = true;
+
+    int score = scorePhysicalDevice(context.devicePolicy, properties[i].deviceType);
+    if (matches && score > bestScore) {
+      selected = (int32_t)i;
+      bestScore = score;
+    }
+  }
+
+  if (selected < 0) {
+    fprintf(stderr, "ERROR no physical device matches the selection, found:\n");
+    for (uint32_t i = 0; i < physicalDevices.size(); ++i)
+      fprintf(stderr, "  %u: %s (%s)\n", i, properties[i].deviceName,
+              physicalDeviceTypeToString(properties[i].deviceType));
+    abort();
+  }
+
+  printf("Using physical device %d: %s (%s)\n", selected, properties[selected].deviceName,
+         physicalDeviceTypeToString(properties[selected].deviceType));
+  return (uint32_t)selected;
 }
 
 static void createVkDevice(Context &context) {
@@ -190,17 +562,24 @@ static void createVkDevice(Context &context) {
   std::vector<VkPhysicalDevice> physicalDevices(gpusCount);
   VULKAN_CHECK(
       vkEnumeratePhysicalDevices(context.instance, &gpusCount, physicalDevices.data()));
-  context.physicalDevice = physicalDevices[0];
+  context.physicalDevice = physicalDevices[selectPhysicalDevice(context, physicalDevices)];
 
   uint32_t queuesCount;
   vkGetPhysicalDeviceQueueFamilyProperties(context.physicalDevice, &queuesCount, nullptr);
+  std::vector<VkQueueFamilyProperties> queueFamilies(queuesCount);
+  vkGetPhysicalDeviceQueueFamilyProperties(context.physicalDevice, &queuesCount, queueFamilies.data());
 
-  if (queuesCount < 1) {
-    fprintf(stderr, "No physical device queues found.\n");
-    abort();
+  // every case records graphics work
+  context.queueFamilyIndex = -1;
+  for (uint32_t i = 0; i < queuesCount && context.queueFamilyIndex < 0; ++i) {
+    if (queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT)
+      context.queueFamilyIndex = (int32_t)i;
   }
 
-  context.queueFamilyIndex = 0;
+  if (context.queueFamilyIndex < 0) {
+    fprintf(stderr, "No graphics queue family found.\n");
+    abort();
+  }
 
   float queuePriority = 1.0f;
 
@@ -212,26 +591,171 @@ static void createVkDevice(Context &context) {
   queueCreateInfo.queueCount = 1;
   queueCreateInfo.pQueuePriorities = &queuePriority;
 
-  const char * extensions[] = {
-    VK_KHR_SWAPCHAIN_EXTENSION_NAME,
-    "VK_KHR_portability_subset",
-  };
+  std::vector<const char *> extensions;
+  if (context.surfaceMode != SurfaceMode::None)
+    extensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+  // required by the spec whenever the implementation advertises it (MoltenVK)
+  if (hasDeviceExtension(context, "VK_KHR_portability_subset"))
+    extensions.push_back("VK_KHR_portability_subset");
+  // per-pipeline compile durations for compilePipelineVariants
+  context.pipelineCreationFeedback =
+      hasDeviceExtension(context, VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
+  if (context.pipelineCreationFeedback)
+    extensions.push_back(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
+
+  // executable statistics for the canary detector
+  VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR executableFeatures;
+  executableFeatures.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR;
+  executableFeatures.pNext = nullptr;
+  executableFeatures.pipelineExecutableInfo = VK_FALSE;
+  // vkGetPhysicalDeviceFeatures2KHR comes with VK_KHR_get_physical_device_properties2,
+  // which createVkInstance always enables; the pointer is a thunk under --lazy-volk
+  if (hasDeviceExtension(context, VK_KHR_PIPELINE_EXECUTABLE_PROPERTIES_EXTENSION_NAME)) {
+    VkPhysicalDeviceFeatures2 features;
+    features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features.pNext = &executableFeatures;
+    vkGetPhysicalDeviceFeatures2KHR(context.physicalDevice, &features);
+  }
+  context.pipelineExecutableProperties = executableFeatures.pipelineExecutableInfo == VK_TRUE;
+  if (context.pipelineExecutableProperties)
+    extensions.push_back(VK_KHR_PIPELINE_EXECUTABLE_PROPERTIES_EXTENSION_NAME);
 
   VkDeviceCreateInfo deviceCreateInfo;
   deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
   deviceCreateInfo.enabledLayerCount = 0;
   deviceCreateInfo.flags = 0;
   deviceCreateInfo.pEnabledFeatures = nullptr;
-  deviceCreateInfo.pNext = nullptr;
+  deviceCreateInfo.pNext = context.pipelineExecutableProperties ? &executableFeatures : nullptr;
   deviceCreateInfo.ppEnabledLayerNames = nullptr;
   deviceCreateInfo.queueCreateInfoCount = 1;
   deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
-  deviceCreateInfo.enabledExtensionCount = std::size(extensions);
-  deviceCreateInfo.ppEnabledExtensionNames = extensions;
+  deviceCreateInfo.enabledExtensionCount = (uint32_t)extensions.size();
+  deviceCreateInfo.ppEnabledExtensionNames = extensions.data();
 
   VULKAN_CHECK(
-      vkCreateDevice(context.physicalDevice, &deviceCreateInfo, nullptr, &context.device));
-  vkGetDeviceQueue(context.device, context.queueFamilyIndex, 0, &context.queue);
+      vkCreateDevice(context.physicalDevice, &deviceCreateInfo, context.allocationCallbacks, &context.device));
+
+  // every device-level call goes through this table rather than the loader
+  // trampolines resolved by volkLoadInstance. It's loaded eagerly when
+  // profiling, since call timing wraps resolved pointers, and under --icd,
+  // since without the loader the lazy tables can't tell devices apart (volk.h)
+  if (context.lazyVolk && !context.profileCalls && context.icdPath.empty())
+    volkLoadDeviceTableLazy(&context.deviceTable, context.device);
+  else
+    volkLoadDeviceTable(&context.deviceTable, context.device);
+  if (context.profileCalls)
+    wrapDeviceTable(context.deviceTable);
+
+  context.deviceTable.vkGetDeviceQueue(context.device, context.queueFamilyIndex, 0, &context.queue);
+}
+
+static void initializeMemoryTypeLookup(Context &context) {
+  vkGetPhysicalDeviceMemoryProperties(context.physicalDevice, &context.memoryProperties);
+
+  // memoryTypeBitsByFlags[flags] has bit i set when memory type i has all of flags
+  for (uint32_t flags = 0; flags < std::size(context.memoryTypeBitsByFlags); ++flags) {
+    uint32_t bits = 0;
+    for (uint32_t i = 0; i < context.memoryProperties.memoryTypeCount; i++) {
+      if ((context.memoryProperties.memoryTypes[i].propertyFlags & flags) == flags)
+        bits |= 1u << i;
+    }
+    context.memoryTypeBitsByFlags[flags] = bits;
+  }
+}
+
+static bool isPipelineCacheCompatible(Context &context,
+                                      const std::vector<char> &data) {
+  // VK_PIPELINE_CACHE_HEADER_VERSION_ONE layout:
+  // headerSize, headerVersion, vendorID, deviceID, pipelineCacheUUID[16]
+  const size_t headerSize = 4 * sizeof(uint32_t) + VK_UUID_SIZE;
+  if (data.size() < headerSize)
+    return false;
+
+  uint32_t header[4];
+  memcpy(header, data.data(), sizeof(header));
+
+  VkPhysicalDeviceProperties properties;
+  vkGetPhysicalDeviceProperties(context.physicalDevice, &properties);
+
+  return header[0] >= headerSize &&
+         header[1] == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+         header[2] == properties.vendorID &&
+         header[3] == properties.deviceID &&
+         memcmp(data.data() + sizeof(header), properties.pipelineCacheUUID,
+                VK_UUID_SIZE) == 0;
+}
+
+static void createPipelineCache(Context &context) {
+  std::vector<char> data;
+  if (!context.coldPipelineCache && !context.pipelineCachePath.empty()) {
+    std::ifstream file(context.pipelineCachePath, std::ios::binary);
+    if (file.is_open()) {
+      file.seekg(0, std::ios_base::end);
+      data.resize((size_t)file.tellg());
+      file.seekg(0, std::ios_base::beg);
+      file.read(data.data(), data.size());
+    }
+
+    if (!data.empty() && !isPipelineCacheCompatible(context, data)) {
+      printf("Ignoring incompatible pipeline cache '%s'\n",
+             context.pipelineCachePath.c_str());
+      data.clear();
+    }
+  }
+
+  VkPipelineCacheCreateInfo createInfo;
+  createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+  createInfo.flags = 0;
+  createInfo.pNext = nullptr;
+  createInfo.initialDataSize = data.size();
+  createInfo.pInitialData = data.empty() ? nullptr : data.data();
+
+  VULKAN_CHECK(context.deviceTable.vkCreatePipelineCache(
+      context.device, &createInfo, context.allocationCallbacks, &context.pipelineCache));
+}
+
+static void savePipelineCache(Context &context) {
+  if (context.pipelineCachePath.empty())
+    return;
+
+  size_t size = 0;
+  VULKAN_CHECK(context.deviceTable.vkGetPipelineCacheData(
+      context.device, context.pipelineCache, &size, nullptr));
+  std::vector<char> data(size);
+  VULKAN_CHECK(context.deviceTable.vkGetPipelineCacheData(
+      context.device, context.pipelineCache, &size, data.data()));
+
+  // write next to the destination and rename over it so concurrent runs never
+  // observe a partially written cache; Contexts in one process need their own
+  std::string tempPath = context.pipelineCachePath + ".tmp." + std::to_string(getpid()) +
+                         "." + std::to_string((uintptr_t)&context);
+  // the default lives in a directory that may not exist yet
+  const std::string &path = context.pipelineCachePath;
+  for (size_t slash = path.find('/', 1); slash != std::string::npos; slash = path.find('/', slash + 1))
+    mkdir(path.substr(0, slash).c_str(), 0755);
+  FILE *file = fopen(tempPath.c_str(), "wb");
+  if (!file) {
+    fprintf(stderr, "ERROR opening file '%s'\n", tempPath.c_str());
+    return;
+  }
+  bool written = fwrite(data.data(), 1, size, file) == size;
+  // flushed to disk before the rename, or a crash could leave the new name
+  // pointing at an empty file
+  written = fflush(file) == 0 && fsync(fileno(file)) == 0 && written;
+  written = fclose(file) == 0 && written;
+  if (!written || rename(tempPath.c_str(), context.pipelineCachePath.c_str()) != 0) {
+    fprintf(stderr, "ERROR writing pipeline cache '%s'\n",
+            context.pipelineCachePath.c_str());
+    remove(tempPath.c_str());
+  }
+}
+
+static void destroyPipelineCache(Context &context) {
+  savePipelineCache(context);
+  context.deviceTable.vkDestroyPipelineCache(context.device,
+                                             context.pipelineCache, context.allocationCallbacks);
+  context.pipelineCache = VK_NULL_HANDLE;
 }
 
 static void createRenderPass(Context &context) {
@@ -245,7 +769,10 @@ static void createRenderPass(Context &context) {
   attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
 
   attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-  attachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+  // PRESENT_SRC_KHR is only valid with VK_KHR_swapchain enabled
+  attachment.finalLayout = context.surfaceMode != SurfaceMode::None
+                               ? VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+                               : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 
   VkAttachmentReference colourAttachmentReference;
   colourAttachmentReference.attachment = 0;
@@ -285,21 +812,29 @@ static void createRenderPass(Context &context) {
   renderPassCreateInfo.dependencyCount = 1;
   renderPassCreateInfo.pDependencies = &dependency;
 
-  VULKAN_CHECK(vkCreateRenderPass(context.device, &renderPassCreateInfo,
-                                  nullptr, &context.renderPass));
+  VULKAN_CHECK(context.deviceTable.vkCreateRenderPass(
+      context.device, &renderPassCreateInfo, context.allocationCallbacks, &context.renderPass));
 }
 
 static void createShaderModules(Context &context) {
-  context.shaderModules[0] = createShaderModule(context, "common/vert.spv");
-  context.shaderModules[1] = createShaderModule(context, "common/frag.spv");
+  if (context.shaderDirectory.empty()) {
+    context.shaderModules[0] = createShaderModule(context, vertSpirv, sizeof(vertSpirv));
+    context.shaderModules[1] = createShaderModule(context, fragSpirv, sizeof(fragSpirv));
+    return;
+  }
+
+  std::string vertPath = context.shaderDirectory + "/vert.spv";
+  std::string fragPath = context.shaderDirectory + "/frag.spv";
+  context.shaderModules[0] = createShaderModule(context, vertPath.c_str());
+  context.shaderModules[1] = createShaderModule(context, fragPath.c_str());
 }
 
 static void destroyShaderModules(Context &context) {
-  vkDestroyShaderModule(context.device, context.shaderModules[0], nullptr);
-  vkDestroyShaderModule(context.device, context.shaderModules[1], nullptr);
+  context.deviceTable.vkDestroyShaderModule(context.device, context.shaderModules[0], context.allocationCallbacks);
+  context.deviceTable.vkDestroyShaderModule(context.device, context.shaderModules[1], context.allocationCallbacks);
 }
 
-static void initializeBasePipeline(Context &context) {
+static void createPipelineLayout(Context &context) {
   VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo;
   pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
   pipelineLayoutCreateInfo.flags = 0;
@@ -308,9 +843,11 @@ static void initializeBasePipeline(Context &context) {
   pipelineLayoutCreateInfo.pSetLayouts = nullptr;
   pipelineLayoutCreateInfo.pushConstantRangeCount = 0l;
   pipelineLayoutCreateInfo.setLayoutCount = 0;
-  VULKAN_CHECK(vkCreatePipelineLayout(context.device, &pipelineLayoutCreateInfo,
-                                      nullptr, &context.pipelineLayout));
+  VULKAN_CHECK(context.deviceTable.vkCreatePipelineLayout(
+      context.device, &pipelineLayoutCreateInfo, context.allocationCallbacks, &context.pipelineLayout));
+}
 
+static void initializeBasePipeline(Context &context) {
   context.vertexInputStateCreateInfo.sType =
       VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
   context.vertexInputStateCreateInfo.flags = 0;
@@ -459,41 +996,141 @@ static void initializeBasePipeline(Context &context) {
   pipelineCreateInfo.subpass = 0;
 }
 
-void initializeContext(Context &context, const char *windowName) {
-  context.cocoaWindow = cocoa_windowCreate(640, 480, windowName);
+#define STARTUP_PHASE(context, call)                                           \
+  do {                                                                         \
+    StartupPhaseScope phase(context.startupPhases, #call);                     \
+    call(context);                                                             \
+  } while (0)
+
+static void createContextDevice(Context &context) {
+#if defined(VK_USE_PLATFORM_METAL_EXT)
+  if (context.surfaceMode == SurfaceMode::Cocoa) {
+    StartupPhaseScope phase(context.startupPhases, "cocoa_windowCreate");
+    context.cocoaWindow = cocoa_windowCreate(640, 480, context.windowName.c_str());
+  }
+#endif
 
   createVkInstance(context);
-  createSurface(context);
-  createVkDevice(context);
-  createShaderModules(context);
-  createRenderPass(context);
-  initializeBasePipeline(context);
+  STARTUP_PHASE(context, createSurface);
+  STARTUP_PHASE(context, createVkDevice);
+  STARTUP_PHASE(context, initializeMemoryTypeLookup);
+  STARTUP_PHASE(context, createPipelineCache);
+}
+
+void ensureContext(Context &context, uint32_t requirements) {
+  if (requirements & RequirePipeline)
+    requirements |= RequireShaders | RequireRenderPass;
+  requirements |= RequireDevice | context.commandLineRequirements;
+
+  uint32_t missing = requirements & ~context.createdRequirements;
+  if (!missing)
+    return;
+
+  size_t firstPhase = context.startupPhases.size();
+  if (missing & RequireDevice) {
+    // only the platform default gives way, --cocoa/--headless always add RequireSurface
+    if (!(requirements & RequireSurface))
+      context.surfaceMode = SurfaceMode::None;
+    if (requirements & RequireValidation)
+      context.enableValidationLayers = true;
+
+    createContextDevice(context);
+
+    context.createdRequirements |= RequireDevice | (requirements & RequireSurface);
+    if (context.enableValidationLayers)
+      context.createdRequirements |= RequireValidation;
+  } else if (missing & RequireInstanceMask) {
+    fprintf(stderr, "ERROR surface and validation must be requested before the instance is created\n");
+    abort();
+  }
+
+  if (missing & RequireShaders)
+    STARTUP_PHASE(context, createShaderModules);
+  if (missing & RequireRenderPass)
+    STARTUP_PHASE(context, createRenderPass);
+  if (missing & RequirePipeline) {
+    STARTUP_PHASE(context, createPipelineLayout);
+    STARTUP_PHASE(context, initializeBasePipeline);
+  }
+  context.createdRequirements |= requirements;
+
+  std::vector<StartupPhase> created(context.startupPhases.begin() + firstPhase,
+                                    context.startupPhases.end());
+  printStartupSummary(created);
+  writeStartupTrace(context.startupPhases, context.startupTracePath);
+}
+
+void initializeContext(Context &context, const char *windowName) {
+  context.windowName = windowName;
+  ensureContext(context, RequireAll);
+}
+
+void resetContext(Context &context) {
+  // cases poke the shared pipeline state, give the next one a clean copy
+  if (context.createdRequirements & RequirePipeline)
+    initializeBasePipeline(context);
+  context.pipeline = VK_NULL_HANDLE;
+}
+
+uint32_t findMemoryTypeIndex(Context &context, uint32_t typeFilter, VkMemoryPropertyFlags propertyFlags) {
+  uint32_t candidates;
+  if (propertyFlags < std::size(context.memoryTypeBitsByFlags)) {
+    candidates = typeFilter & context.memoryTypeBitsByFlags[propertyFlags];
+  } else {
+    candidates = 0;
+    for (uint32_t i = 0; i < context.memoryProperties.memoryTypeCount; i++) {
+      if ((context.memoryProperties.memoryTypes[i].propertyFlags & propertyFlags) == propertyFlags)
+        candidates |= 1u << i;
+    }
+    candidates &= typeFilter;
+  }
+  // memory types are ordered by preference, so the lowest set bit wins
+  return candidates ? (uint32_t)__builtin_ctz(candidates) : UINT32_MAX;
 }
 
 uint32_t getMemoryTypeIndex(Context& context, uint32_t typeFilter, VkMemoryPropertyFlags propertyFlags) {
-  VkPhysicalDeviceMemoryProperties memoryProperties;
-  vkGetPhysicalDeviceMemoryProperties(context.physicalDevice, &memoryProperties);
-  
-  for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
-      if ((typeFilter & (1 << i)) && (memoryProperties.memoryTypes[i].propertyFlags & propertyFlags) == propertyFlags) {
-          return i;
-      }
+  uint32_t index = findMemoryTypeIndex(context, typeFilter, propertyFlags);
+  if (index != UINT32_MAX)
+    return index;
+
+  fprintf(stderr, "ERROR failed to memory type %u\n", typeFilter);
+  abort();
+}
+
+uint32_t getMemoryTypeIndex(Context &context, uint32_t typeFilter,
+                            std::initializer_list<VkMemoryPropertyFlags> preferences) {
+  for (VkMemoryPropertyFlags propertyFlags : preferences) {
+    uint32_t index = findMemoryTypeIndex(context, typeFilter, propertyFlags);
+    if (index != UINT32_MAX)
+      return index;
   }
+
   fprintf(stderr, "ERROR failed to memory type %u\n", typeFilter);
   abort();
 }
 
 void destroyContext(Context &context)
 {
+  if (!(context.createdRequirements & RequireDevice))
+    return;
+
   destroyShaderModules(context);
+  destroyPipelineCache(context);
+  // the Context and its table may be freed next, e.g. by runFanOut
+  volkUnloadDeviceTableLazy(&context.deviceTable);
+  if (context.debugMessenger)
+    vkDestroyDebugUtilsMessengerEXT(context.instance, context.debugMessenger, context.allocationCallbacks);
+  context.debugMessenger = VK_NULL_HANDLE;
+  destroyValidationLog(context.validationLog);
+  context.validationLog = nullptr;
 }
 
 void createPipeline(Context &context) {
-  VULKAN_CHECK(vkCreateGraphicsPipelines(context.device, VK_NULL_HANDLE, 1,
-                                         &context.basePipelineCreateInfo,
-                                         nullptr, &context.pipeline));
+  VULKAN_CHECK(context.deviceTable.vkCreateGraphicsPipelines(
+      context.device, context.pipelineCache, 1, &context.basePipelineCreateInfo,
+      context.allocationCallbacks, &context.pipeline));
 }
 
 void destroyPipeline(Context &context) {
-  vkDestroyPipeline(context.device, context.pipeline, NULL);
+  context.deviceTable.vkDestroyPipeline(context.device, context.pipeline, context.allocationCallbacks);
 }
@@ -1,24 +1,96 @@
 #pragma once
 
 #include <stdio.h>
+#include <initializer_list>
+#include <string>
+#include <vector>
 #include "volk/volk.h"
+#include "host_allocator.h"
+#include "startup_trace.h"
+#include "validation_log.h"
 
+#if defined(VK_USE_PLATFORM_METAL_EXT)
 void *cocoa_windowCreate(int width, int height, const char *title);
 void *cocoa_windowGetLayer(void *cocoaWindow);
+#endif
 
 void VULKAN_CHECK(VkResult result);
 
+enum class SurfaceMode {
+  // VK_EXT_metal_surface backed by a Cocoa window (MoltenVK)
+  Cocoa,
+  // VK_EXT_headless_surface, no window system required
+  Headless,
+  // no surface and no swapchain extension at all
+  None,
+};
+
+// How createVkDevice picks a physical device when neither an index, a UUID
+// nor a name selects one.
+enum class DevicePolicy {
+  // enumeration order, the first device
+  First,
+  // discrete, then integrated, virtual and CPU devices
+  Performance,
+  // a CPU implementation such as lavapipe or SwiftShader if there is one
+  Software,
+};
+
+// What a case needs from its Context; ensureContext creates only these, in
+// dependency order. Surface and validation change how the instance is created
+// so they must be requested before the first ensureContext.
+enum ContextRequirement : uint32_t {
+  // instance, device, queue, memory type lookup and pipeline cache
+  RequireDevice = 1 << 0,
+  // the window (Cocoa) and VkSurfaceKHR selected by surfaceMode
+  RequireSurface = 1 << 1,
+  // VK_LAYER_KHRONOS_validation, also enabled by --debug
+  RequireValidation = 1 << 2,
+  RequireShaders = 1 << 3,
+  RequireRenderPass = 1 << 4,
+  // pipeline layout and base pipeline state, implies shaders and render pass
+  RequirePipeline = 1 << 5,
+
+  RequireInstanceMask = RequireSurface | RequireValidation,
+  RequireAll = RequireDevice | RequireSurface | RequireShaders | RequireRenderPass | RequirePipeline,
+};
+
 struct Context {
   Context(int argc, const char *argv[]);
   VkInstance instance = (VkInstance)VK_NULL_HANDLE;
   VkPhysicalDevice physicalDevice = (VkPhysicalDevice)VK_NULL_HANDLE;
   VkDevice device = (VkDevice)VK_NULL_HANDLE;
   VkQueue queue = (VkQueue)VK_NULL_HANDLE;
+  VolkDeviceTable deviceTable = {};
   VkSurfaceKHR surface = (VkSurfaceKHR)VK_NULL_HANDLE;
   VkPipelineLayout pipelineLayout = (VkPipelineLayout)VK_NULL_HANDLE;
   VkRenderPass renderPass = (VkRenderPass)VK_NULL_HANDLE;
   VkPipeline pipeline = (VkPipeline)VK_NULL_HANDLE;
-  VkShaderModule shaderModules[2];
+  VkPipelineCache pipelineCache = (VkPipelineCache)VK_NULL_HANDLE;
+  // both only exist with validation enabled, see validation_log.h
+  VkDebugUtilsMessengerEXT debugMessenger = (VkDebugUtilsMessengerEXT)VK_NULL_HANDLE;
+  ValidationLog *validationLog = nullptr;
+  // --host-allocator; every create and destroy passes allocationCallbacks,
+  // which stays null (driver's own allocator) unless it is enabled
+  HostAllocator *hostAllocator = nullptr;
+  const VkAllocationCallbacks *allocationCallbacks = nullptr;
+  bool hostAllocatorEnabled = false;
+  // --host-arena; bump-allocate object-scope host memory per thread
+  bool hostArena = false;
+  // --profile-calls; time volk and deviceTable calls, see call_timing.h
+  bool profileCalls = false;
+  // --lazy-volk; resolve entry points on first call, see volk_lazy.cpp
+  bool lazyVolk = false;
+  // --icd=<library>; load this driver directly instead of the Vulkan loader
+  std::string icdPath;
+  // physical device selection; an index >= 0 (set by runFanOut for the Context
+  // that enumerates the devices) wins, then --device-uuid, then --device
+  // (substring of the name), then --device-policy
+  int32_t physicalDeviceIndex = -1;
+  std::string deviceUuid;
+  std::string deviceName;
+  DevicePolicy devicePolicy = DevicePolicy::First;
+  VkShaderModule shaderModules[2] = {};
   VkPipelineShaderStageCreateInfo shaderStageCreateInfos[2];
   VkPipelineColorBlendAttachmentState colourBlendAttachmentState;
   VkPipelineColorBlendStateCreateInfo colourBlendStateCreateInfo;
@@ -30,17 +102,70 @@ struct Context {
   VkPipelineMultisampleStateCreateInfo multisampleStateCreateInfo;
   VkPipelineDynamicStateCreateInfo dynamicStateCreateInfo;
   VkGraphicsPipelineCreateInfo basePipelineCreateInfo;
+  VkPhysicalDeviceMemoryProperties memoryProperties;
+  // indexed by VkMemoryPropertyFlags, covers every flag up to RDMA_CAPABLE_BIT_NV
+  uint32_t memoryTypeBitsByFlags[512];
   VkViewport viewport;
   VkRect2D scissor;
 
   void *cocoaWindow = nullptr;
   int32_t queueFamilyIndex = -1;
   bool enableValidationLayers = false;
+  bool pipelineCreationFeedback = false;
+  bool pipelineExecutableProperties = false;
+  // point ignored pointers at PROT_NONE pages, see guard_pages.h
+  bool guardPages = false;
+  // load vert.spv/frag.spv from here instead of the embedded SPIR-V
+  std::string shaderDirectory;
+  // ignore any cache on disk; the cache is still written back at destroyContext
+  bool coldPipelineCache = false;
+  // empty disables loading and saving the pipeline cache; defaults to
+  // vk_parameter_zoo/pipelinecache in the user's cache directory
+  std::string pipelineCachePath;
+  // ContextRequirement bits already created by ensureContext
+  uint32_t createdRequirements = 0;
+  // ContextRequirement bits the command line asks for on top of every case's,
+  // e.g. RequireSurface from --cocoa/--headless
+  uint32_t commandLineRequirements = 0;
+  std::string windowName = "vk_parameter_zoo";
+  // threads a case may spread its own work over, see getThreadBudget
+  uint32_t threadBudget = 0;
+  // filled in by ensureContext, see startup_trace.h
+  std::vector<StartupPhase> startupPhases;
+  // empty skips the Chrome trace JSON, the summary line is always printed
+  std::string startupTracePath;
+#if defined(VK_USE_PLATFORM_METAL_EXT)
+  SurfaceMode surfaceMode = SurfaceMode::Cocoa;
+#elif defined(VK_PARAMETER_ZOO_HEADLESS)
+  SurfaceMode surfaceMode = SurfaceMode::Headless;
+#else
+  SurfaceMode surfaceMode = SurfaceMode::None;
+#endif
 };
 
+// ensureContext(context, RequireAll)
 void initializeContext(Context &context, const char *windowName);
+// creates whatever ContextRequirement bits are still missing, then prints the
+// startup summary for what it created
+void ensureContext(Context &context, uint32_t requirements);
+// restores the base pipeline state between cases sharing one Context
+void resetContext(Context &context);
 void destroyContext(Context &context);
+// lower-case hex without dashes, the form --device-uuid matches against;
+// needs VK_KHR_external_memory_capabilities on the instance
+std::string getPhysicalDeviceUuid(VkPhysicalDevice physicalDevice);
+// context.threadBudget, or one thread per hardware thread when it is 0; runners
+// that drive several Contexts at once split the machine between them
+uint32_t getThreadBudget(const Context &context);
+VkShaderModule createShaderModule(Context &context, const uint32_t *code, size_t codeSize);
+// memory-maps a SPIR-V binary and hands the mapping straight to the driver
+VkShaderModule createShaderModule(Context &context, const char *path);
+// returns UINT32_MAX when no memory type matches
+uint32_t findMemoryTypeIndex(Context &context, uint32_t typeFilter, VkMemoryPropertyFlags propertyFlags);
 uint32_t getMemoryTypeIndex(Context& context, uint32_t typeFilter, VkMemoryPropertyFlags propertyFlags);
+// tries each entry in order, e.g. {DEVICE_LOCAL, HOST_VISIBLE | HOST_COHERENT}
+uint32_t getMemoryTypeIndex(Context &context, uint32_t typeFilter,
+                            std::initializer_list<VkMemoryPropertyFlags> preferences);
 
 void createPipeline(Context &context);
 void destroyPipeline(Context &context);
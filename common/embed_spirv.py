@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""Embed SPIR-V shaders as constexpr uint32_t arrays.
+
+Each input is either GLSL (compiled with glslangValidator) or an existing
+.spv binary. The array is named after the file stem, e.g. vert.glsl -> vertSpirv.
+
+  embed_spirv.py -o build/generated/embedded_spirv.h common/vert.glsl common/frag.glsl
+"""
+import argparse
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+
+SPIRV_MAGIC = 0x07230203
+STAGES = {"vert": "vert", "frag": "frag"}
+
+
+def compile_glsl(path, glslang):
+    stem = os.path.splitext(os.path.basename(path))[0]
+    with tempfile.TemporaryDirectory() as tmp:
+        out = os.path.join(tmp, stem + ".spv")
+        cmd = [glslang, "-V", "-S", STAGES.get(stem, stem), "-o", out, path]
+        subprocess.run(cmd, check=True, stdout=subprocess.DEVNULL)
+        with open(out, "rb") as f:
+            return f.read()
+
+
+def load(path, glslang):
+    if path.endswith(".spv"):
+        with open(path, "rb") as f:
+            return f.read()
+    if not glslang:
+        # fall back to the checked-in binary next to the source
+        spv = os.path.splitext(path)[0] + ".spv"
+        print("glslangValidator not found, embedding %s" % spv, file=sys.stderr)
+        with open(spv, "rb") as f:
+            return f.read()
+    return compile_glsl(path, glslang)
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-o", "--output", required=True)
+    parser.add_argument("--glslang", default=shutil.which("glslangValidator"))
+    parser.add_argument("inputs", nargs="+")
+    args = parser.parse_args()
+
+    lines = [
+        "// Generated by common/embed_spirv.py, do not edit.",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+    ]
+    for path in args.inputs:
+        code = load(path, args.glslang)
+        if len(code) % 4 != 0:
+            sys.exit("%s: size is not a multiple of 4" % path)
+        words = struct.unpack("<%dI" % (len(code) // 4), code)
+        if words[0] != SPIRV_MAGIC:
+            sys.exit("%s: not a SPIR-V module" % path)
+        name = os.path.splitext(os.path.basename(path))[0] + "Spirv"
+        lines.append("// %s" % os.path.basename(path))
+        lines.append("constexpr uint32_t %s[] = {" % name)
+        for i in range(0, len(words), 8):
+            lines.append("    " + ", ".join("0x%08x" % w for w in words[i:i + 8]) + ",")
+        lines.append("};")
+        lines.append("")
+
+    # always written, even when unchanged: the build reruns this whenever an
+    # input is newer than the output, so a stale timestamp would rerun it on
+    # every build
+    with open(args.output, "w") as f:
+        f.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+    main()
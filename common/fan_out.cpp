@@ -0,0 +1,143 @@
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include "fan_out.h"
+
+struct FanOutDevice {
+  std::unique_ptr<Context> context;
+  std::string name;
+  std::vector<ZooCaseResult> results;
+};
+
+// enumeration order is only stable within one instance, so every Context but
+// the first selects its device by the UUID the first one read
+static void configureFanOutContext(Context &context, uint32_t index, const std::string &uuid) {
+  if (uuid.empty()) {
+    context.physicalDeviceIndex = (int32_t)index;
+  } else {
+    context.physicalDeviceIndex = -1;
+    context.deviceUuid = uuid;
+  }
+  // a shared file would be overwritten by whichever device saves last; every
+  // thread has the same pid, so %p doesn't tell the startup traces apart
+  if (!context.pipelineCachePath.empty())
+    context.pipelineCachePath += "." + std::to_string(index);
+  if (!context.startupTracePath.empty())
+    context.startupTracePath += "." + std::to_string(index);
+}
+
+static void runFanOutDevice(FanOutDevice &device, uint32_t requirements,
+                            const std::vector<const ZooCase *> &cases) {
+  Context &context = *device.context;
+  ensureContext(context, requirements);
+
+  VkPhysicalDeviceProperties properties;
+  vkGetPhysicalDeviceProperties(context.physicalDevice, &properties);
+  device.name = properties.deviceName;
+
+  for (const ZooCase *zooCase : cases) {
+    printf("[ RUN  ] %s on %s\n", zooCase->name, device.name.c_str());
+    auto start = std::chrono::steady_clock::now();
+
+    runZooCase(context, zooCase);
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    device.results.push_back({zooCase, ZooCaseStatus::Passed, 0, ms});
+    printZooCaseResult(device.results.back());
+  }
+
+  destroyContext(context);
+}
+
+static void printFanOutTable(const std::vector<FanOutDevice> &devices,
+                             const std::vector<const ZooCase *> &cases) {
+  printf("[FANOUT] %zu devices\n", devices.size());
+  for (size_t d = 0; d < devices.size(); ++d)
+    printf("[FANOUT] device %zu: %s\n", d, devices[d].name.c_str());
+
+  size_t nameWidth = 8;
+  for (const ZooCase *zooCase : cases)
+    nameWidth = std::max(nameWidth, strlen(zooCase->name));
+
+  printf("%-*s", (int)nameWidth, "case");
+  for (size_t d = 0; d < devices.size(); ++d)
+    printf(" %11s%-3zu", "device ", d);
+  printf(" %8s\n", "spread");
+
+  for (size_t c = 0; c < cases.size(); ++c) {
+    printf("%-*s", (int)nameWidth, cases[c]->name);
+    double fastest = 0.0, slowest = 0.0;
+    for (size_t d = 0; d < devices.size(); ++d) {
+      double ms = devices[d].results[c].ms;
+      printf(" %11.3f ms", ms);
+      fastest = d == 0 ? ms : std::min(fastest, ms);
+      slowest = std::max(slowest, ms);
+    }
+    // slowest over fastest device
+    printf(" %7.2fx\n", fastest > 0.0 ? slowest / fastest : 1.0);
+  }
+}
+
+std::vector<ZooCaseResult> runFanOut(int argc, const char *argv[],
+                                     const std::vector<const ZooCase *> &cases) {
+  uint32_t requirements = RequireDevice | (getZooCaseRequirements(cases) & RequireInstanceMask);
+
+  // the first Context counts the devices and then runs on device 0
+  std::vector<FanOutDevice> devices(1);
+  devices[0].context.reset(new Context(argc, argv));
+  requirements |= devices[0].context->commandLineRequirements;
+  if ((requirements & RequireSurface) && devices[0].context->surfaceMode == SurfaceMode::Cocoa) {
+    fprintf(stderr, "ERROR --fan-out can't create Cocoa windows off the main thread, use --headless or --no-surface\n");
+    abort();
+  }
+  // guard pages, their fault counts and the signal handler are process-wide,
+  // so devices probing at once would re-arm each other's pages mid-probe
+  if (devices[0].context->guardPages) {
+    fprintf(stderr, "ERROR --fan-out can't share guard pages between devices, drop --guard-pages\n");
+    abort();
+  }
+  configureFanOutContext(*devices[0].context, 0, std::string());
+  ensureContext(*devices[0].context, requirements);
+
+  uint32_t count = 0;
+  VULKAN_CHECK(vkEnumeratePhysicalDevices(devices[0].context->instance, &count, nullptr));
+  std::vector<VkPhysicalDevice> physicalDevices(count);
+  VULKAN_CHECK(vkEnumeratePhysicalDevices(devices[0].context->instance, &count, physicalDevices.data()));
+  std::vector<std::string> uuids(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    uuids[i] = getPhysicalDeviceUuid(physicalDevices[i]);
+    for (uint32_t j = 0; j < i; ++j) {
+      if (uuids[j] == uuids[i]) {
+        fprintf(stderr, "ERROR --fan-out devices %u and %u report the same UUID %s\n", j, i, uuids[i].c_str());
+        abort();
+      }
+    }
+  }
+
+  devices.resize(count);
+  for (uint32_t i = 1; i < count; ++i) {
+    devices[i].context.reset(new Context(argc, argv));
+    configureFanOutContext(*devices[i].context, i, uuids[i]);
+  }
+  // every device runs its cases at the same time as the others
+  for (FanOutDevice &device : devices)
+    device.context->threadBudget = std::max(1u, std::thread::hardware_concurrency() / count);
+
+  std::vector<std::thread> threads;
+  for (FanOutDevice &device : devices)
+    threads.emplace_back(runFanOutDevice, std::ref(device), requirements, std::cref(cases));
+  for (std::thread &thread : threads)
+    thread.join();
+
+  printFanOutTable(devices, cases);
+
+  std::vector<ZooCaseResult> results;
+  for (const FanOutDevice &device : devices)
+    results.insert(results.end(), device.results.begin(), device.results.end());
+  return results;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <vector>
+#include "common.h"
+#include "zoo_case.h"
+
+// Runs every case on every enumerated physical device at once, one thread and
+// one Context per device, then prints a per-device comparison table. Cases run
+// in process, so a driver crash still takes down the whole run.
+
+std::vector<ZooCaseResult> runFanOut(int argc, const char *argv[],
+                                     const std::vector<const ZooCase *> &cases);
@@ -0,0 +1,151 @@
+#include <errno.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <chrono>
+#include "call_timing.h"
+#include "fork_server.h"
+
+static const double probeTimeoutSeconds = 10.0;
+
+static double millisecondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+pid_t forkChild() {
+  // anything still buffered would be written by both processes
+  fflush(stdout);
+  fflush(stderr);
+  pid_t pid = fork();
+  if (pid < 0) {
+    perror("fork");
+    abort();
+  }
+  // the child's dump should not repeat what the parent timed before the fork
+  if (pid == 0)
+    resetCallTimings();
+  return pid;
+}
+
+void exitChild(int status) {
+  // the atexit dump would be skipped along with everything else
+  printCallTimings();
+  fflush(stdout);
+  fflush(stderr);
+  // skip atexit handlers and static destructors that belong to the parent
+  _exit(status);
+}
+
+void setZooCaseExitStatus(ZooCaseResult &result, int waitStatus) {
+  if (WIFSIGNALED(waitStatus)) {
+    result.status = ZooCaseStatus::Crashed;
+    result.code = WTERMSIG(waitStatus);
+  } else {
+    result.code = WEXITSTATUS(waitStatus);
+    result.status = result.code == 0 ? ZooCaseStatus::Passed : ZooCaseStatus::Failed;
+  }
+}
+
+static ZooCaseResult waitForChild(pid_t pid, const ZooCase *zooCase, double timeoutSeconds) {
+  ZooCaseResult result = {zooCase, ZooCaseStatus::Passed, 0, 0.0};
+  auto start = std::chrono::steady_clock::now();
+  for (;;) {
+    int status = 0;
+    pid_t waited = waitpid(pid, &status, WNOHANG);
+    if (waited < 0 && errno != EINTR) {
+      perror("waitpid");
+      abort();
+    }
+
+    if (waited == pid) {
+      result.ms = millisecondsSince(start);
+      setZooCaseExitStatus(result, status);
+      return result;
+    }
+
+    if (millisecondsSince(start) > timeoutSeconds * 1000.0) {
+      kill(pid, SIGKILL);
+      waitpid(pid, &status, 0);
+      result.status = ZooCaseStatus::TimedOut;
+      result.ms = millisecondsSince(start);
+      return result;
+    }
+
+    usleep(1000);
+  }
+}
+
+// Builds and destroys a pipeline on the inherited device. Drivers that keep
+// per-process kernel state (Metal, most GPU KMDs) tend to crash or hang here.
+static bool probeInheritedDevice(Context &context) {
+  pid_t pid = forkChild();
+  if (pid == 0) {
+    ensureContext(context, RequirePipeline);
+    createPipeline(context);
+    destroyPipeline(context);
+    VULKAN_CHECK(context.deviceTable.vkDeviceWaitIdle(context.device));
+    exitChild(0);
+  }
+
+  ZooCaseResult result = waitForChild(pid, nullptr, probeTimeoutSeconds);
+  return result.status == ZooCaseStatus::Passed;
+}
+
+// The device the probe inherits is set up in a throwaway child, so this
+// process never touches the driver: if the probe fails, the Fresh children are
+// forked from a parent without any driver state to inherit.
+static bool probeWarmFork(int argc, const char *argv[], uint32_t requirements,
+                          const ForkServerOptions &options) {
+  pid_t pid = forkChild();
+  if (pid == 0) {
+    Context context(argc, argv);
+    ensureContext(context, requirements);
+    exitChild(probeInheritedDevice(context) ? 0 : 1);
+  }
+
+  ZooCaseResult result = waitForChild(pid, nullptr, options.timeoutSeconds + probeTimeoutSeconds);
+  return result.status == ZooCaseStatus::Passed;
+}
+
+std::vector<ZooCaseResult> runForkServer(int argc, const char *argv[],
+                                         const std::vector<const ZooCase *> &cases,
+                                         const ForkServerOptions &options) {
+  uint32_t requirements = RequireDevice | (getZooCaseRequirements(cases) & RequireInstanceMask);
+  ForkMode mode = options.mode;
+  if (mode == ForkMode::Auto) {
+    mode = probeWarmFork(argc, argv, requirements, options) ? ForkMode::Warm : ForkMode::Fresh;
+    printf("fork server: %s\n", mode == ForkMode::Warm
+                                    ? "children inherit the device"
+                                    : "driver does not survive fork, children initialize from scratch");
+  }
+
+  Context context(argc, argv);
+  if (mode == ForkMode::Warm)
+    ensureContext(context, requirements);
+
+  std::vector<ZooCaseResult> results;
+  for (const ZooCase *zooCase : cases) {
+    printf("[ RUN  ] %s\n", zooCase->name);
+
+    pid_t pid = forkChild();
+    if (pid == 0) {
+      if (mode == ForkMode::Warm) {
+        runZooCase(context, zooCase);
+      } else {
+        Context fresh(argc, argv);
+        fresh.windowName = zooCase->name;
+        runZooCase(fresh, zooCase);
+        destroyContext(fresh);
+      }
+      exitChild(0);
+    }
+
+    results.push_back(waitForChild(pid, zooCase, options.timeoutSeconds));
+    printZooCaseResult(results.back());
+  }
+
+  if (mode == ForkMode::Warm)
+    destroyContext(context);
+  return results;
+}
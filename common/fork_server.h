@@ -0,0 +1,37 @@
+#pragma once
+
+#include <sys/types.h>
+#include <vector>
+#include "common.h"
+#include "zoo_case.h"
+
+// Runs each case in a forked child so a driver crash or hang only loses that
+// case. The parent pays for instance and device creation once; whether a
+// child can keep using the inherited device is driver specific.
+
+enum class ForkMode {
+  // a throwaway child sets up a device and forks a probe; Warm if the probe
+  // survives, Fresh otherwise
+  Auto,
+  // children inherit the parent's instance and device
+  Warm,
+  // children build their own Context from scratch
+  Fresh,
+};
+
+struct ForkServerOptions {
+  ForkMode mode = ForkMode::Auto;
+  // a child still running after this long is killed
+  double timeoutSeconds = 60.0;
+};
+
+// fork() with stdio flushed first so buffered output is not written twice
+pid_t forkChild();
+// leaves a forked child without running the parent's atexit handlers
+[[noreturn]] void exitChild(int status);
+// Passed, Failed or Crashed from a waitpid() status
+void setZooCaseExitStatus(ZooCaseResult &result, int waitStatus);
+
+std::vector<ZooCaseResult> runForkServer(int argc, const char *argv[],
+                                         const std::vector<const ZooCase *> &cases,
+                                         const ForkServerOptions &options);
@@ -0,0 +1,162 @@
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+#include "guard_pages.h"
+
+static const uint32_t MaxGuardPages = 64;
+
+static std::mutex guardMutex;
+static char *guardBase = nullptr;
+static size_t guardPageSize = 0;
+static uint32_t guardPageCount = 0;
+static const char *guardNames[MaxGuardPages];
+static std::atomic<uint32_t> guardFaults[MaxGuardPages];
+static struct sigaction previousSegvAction;
+static struct sigaction previousBusAction;
+
+static void guardPageHandler(int signal, siginfo_t *info, void *ucontext) {
+  char *address = (char *)info->si_addr;
+  if (guardBase && address >= guardBase &&
+      address < guardBase + (size_t)MaxGuardPages * guardPageSize) {
+    size_t page = (size_t)(address - guardBase) / guardPageSize;
+    // the first fault is a read, make the page readable (zero filled); a
+    // fault on a readable page can only be a write
+    uint32_t faults = guardFaults[page].fetch_add(1, std::memory_order_relaxed);
+    mprotect(guardBase + page * guardPageSize, guardPageSize,
+             faults == 0 ? PROT_READ : PROT_READ | PROT_WRITE);
+    return;
+  }
+
+  // not one of ours, hand it to whoever was installed before
+  struct sigaction &previous = signal == SIGBUS ? previousBusAction : previousSegvAction;
+  if (previous.sa_flags & SA_SIGINFO) {
+    previous.sa_sigaction(signal, info, ucontext);
+  } else if (previous.sa_handler == SIG_DFL || previous.sa_handler == SIG_IGN) {
+    // returning re-executes the faulting instruction with the old disposition
+    sigaction(signal, &previous, nullptr);
+  } else {
+    previous.sa_handler(signal);
+  }
+}
+
+static void initializeGuardPages() {
+  guardPageSize = (size_t)sysconf(_SC_PAGESIZE);
+  void *mapping = mmap(nullptr, MaxGuardPages * guardPageSize, PROT_NONE,
+                       MAP_PRIVATE | MAP_ANON, -1, 0);
+  if (mapping == MAP_FAILED) {
+    fprintf(stderr, "ERROR mapping guard pages\n");
+    abort();
+  }
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_sigaction = guardPageHandler;
+  action.sa_flags = SA_SIGINFO | SA_NODEFER;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGSEGV, &action, &previousSegvAction);
+  // macOS reports some protection faults as SIGBUS
+  sigaction(SIGBUS, &action, &previousBusAction);
+
+  guardBase = (char *)mapping;
+}
+
+void *getGuardPage(const char *name) {
+  std::lock_guard<std::mutex> lock(guardMutex);
+  if (!guardBase)
+    initializeGuardPages();
+
+  for (uint32_t i = 0; i < guardPageCount; ++i) {
+    if (strcmp(guardNames[i], name) == 0)
+      return guardBase + i * guardPageSize;
+  }
+
+  if (guardPageCount == MaxGuardPages) {
+    fprintf(stderr, "ERROR out of guard pages for '%s'\n", name);
+    abort();
+  }
+  guardNames[guardPageCount] = name;
+  return guardBase + guardPageCount++ * guardPageSize;
+}
+
+void armGuardPages() {
+  std::lock_guard<std::mutex> lock(guardMutex);
+  for (uint32_t i = 0; i < guardPageCount; ++i) {
+    char *page = guardBase + i * guardPageSize;
+    if (guardFaults[i].load(std::memory_order_relaxed) > 1) {
+      // the driver wrote to it, restore the zero fill
+      mprotect(page, guardPageSize, PROT_READ | PROT_WRITE);
+      memset(page, 0, guardPageSize);
+    }
+    mprotect(page, guardPageSize, PROT_NONE);
+    guardFaults[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+std::vector<GuardPageHit> collectGuardPageHits() {
+  std::lock_guard<std::mutex> lock(guardMutex);
+  std::vector<GuardPageHit> hits;
+  for (uint32_t i = 0; i < guardPageCount; ++i) {
+    uint32_t faults = guardFaults[i].load(std::memory_order_relaxed);
+    if (faults > 0)
+      hits.push_back({guardNames[i], faults});
+  }
+  return hits;
+}
+
+void *poisonPointer(Context &context, const char *name) {
+  if (!context.guardPages)
+    return (void *)0x1234;
+  return getGuardPage(name);
+}
+
+uint32_t reportGuardPageHits(Context &context, const char *probe) {
+  if (!context.guardPages)
+    return 0;
+
+  std::vector<GuardPageHit> hits = collectGuardPageHits();
+  for (const GuardPageHit &hit : hits)
+    printf("%s: driver dereferenced ignored %s (%s)\n", probe, hit.name,
+           hit.faults > 1 ? "read/write" : "read");
+  armGuardPages();
+  return (uint32_t)hits.size();
+}
+
+std::vector<GuardPageProbe> runGuardPageProbes(Context &context,
+                                               const std::vector<Mutation> &mutations) {
+  const std::vector<PoisonField> &fields = getPoisonFields();
+  std::vector<GuardPageProbe> probes;
+  std::unordered_set<uint64_t> hashes;
+  PipelineState state;
+
+  for (const Mutation &mutation : mutations) {
+    initializePipelineState(context, state);
+    applyPreconditions(mutation.preconditions, state);
+    for (const Poison &poison : mutation.poisons) {
+      const PoisonField &field = fields[poison.field];
+      field.apply(state, field.isPointer ? (uint64_t)(uintptr_t)getGuardPage(field.name)
+                                         : field.values[poison.value]);
+    }
+    // mutations that only differed by pointer value now point at the same
+    // guard pages, compile each resulting state once
+    if (!hashes.insert(hashPipelineState(state)).second)
+      continue;
+
+    armGuardPages();
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkResult result = context.deviceTable.vkCreateGraphicsPipelines(
+        context.device, VK_NULL_HANDLE, 1, &state.createInfo, context.allocationCallbacks, &pipeline);
+    if (result == VK_SUCCESS)
+      context.deviceTable.vkDestroyPipeline(context.device, pipeline, context.allocationCallbacks);
+
+    GuardPageProbe probe;
+    probe.mutation = mutation;
+    probe.hits = collectGuardPageHits();
+    probes.push_back(std::move(probe));
+  }
+  armGuardPages();
+  return probes;
+}
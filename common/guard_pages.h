@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "common.h"
+#include "mutation.h"
+
+// Guard-page mode: ignored pointers point at PROT_NONE pages instead of
+// 0x1234. A SIGSEGV/SIGBUS handler records which page the driver touched,
+// maps it zero-filled so the driver can carry on, and the run continues.
+
+struct GuardPageHit {
+  const char *name;
+  uint32_t faults;
+};
+
+// the page reserved for this field name, the same name always gets the same page
+void *getGuardPage(const char *name);
+// re-protect every page and clear the recorded hits
+void armGuardPages();
+std::vector<GuardPageHit> collectGuardPageHits();
+
+// 0x1234, or the field's guard page when running with --guard-pages
+void *poisonPointer(Context &context, const char *name);
+// prints and re-arms; returns the number of fields the driver dereferenced
+uint32_t reportGuardPageHits(Context &context, const char *probe);
+
+struct GuardPageProbe {
+  Mutation mutation;
+  std::vector<GuardPageHit> hits;
+};
+
+// compiles each mutation serially with its pointer poisons replaced by guard
+// pages so every fault can be attributed to exactly one field; mutations that
+// end up in the same state are probed once, by the first of them
+std::vector<GuardPageProbe> runGuardPageProbes(Context &context,
+                                               const std::vector<Mutation> &mutations);
@@ -0,0 +1,264 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include "host_allocator.h"
+
+struct ArenaBlock {
+  char *base;
+  size_t size;
+  // only touched by the owning thread
+  size_t used;
+  // outstanding allocations plus one while the block is the thread's current
+  // block; whoever drops it to zero frees the block
+  std::atomic<uint64_t> references;
+};
+
+// sits immediately before every pointer handed to the driver
+struct AllocationHeader {
+  uint64_t size;
+  uint32_t scope;
+  // distance back from the user pointer to the start of the malloc block
+  uint32_t offset;
+  // null for malloc-backed allocations
+  ArenaBlock *block;
+};
+
+static std::atomic<uint64_t> nextHostAllocatorId{1};
+
+static const char *scopeNames[HostAllocationScopeCount] = {
+    "command", "object", "cache", "device", "instance",
+};
+
+// rounded up so the pointer after the header keeps the requested alignment
+static size_t headerSpace(size_t alignment) {
+  return (sizeof(AllocationHeader) + alignment - 1) & ~(alignment - 1);
+}
+
+static AllocationHeader *getHeader(void *memory) {
+  return (AllocationHeader *)memory - 1;
+}
+
+static void releaseBlock(ArenaBlock *block) {
+  if (block->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    free(block->base);
+    delete block;
+  }
+}
+
+struct ThreadArena {
+  ~ThreadArena() {
+    if (block)
+      releaseBlock(block);
+  }
+
+  uint64_t allocatorId = 0;
+  ArenaBlock *block = nullptr;
+};
+
+static thread_local ThreadArena threadArena;
+
+static ArenaBlock *createBlock(size_t size) {
+  ArenaBlock *block = new ArenaBlock();
+  if (posix_memalign((void **)&block->base, 64, size) != 0) {
+    delete block;
+    return nullptr;
+  }
+  block->size = size;
+  block->used = 0;
+  block->references.store(1);
+  return block;
+}
+
+static void *allocateFromArena(HostAllocator *allocator, size_t size, size_t alignment) {
+  if (threadArena.allocatorId != allocator->id) {
+    // a block from another allocator lives on until its allocations are freed
+    if (threadArena.block)
+      releaseBlock(threadArena.block);
+    threadArena.allocatorId = allocator->id;
+    threadArena.block = nullptr;
+  }
+
+  size_t space = headerSpace(alignment);
+  size_t needed = space + size;
+  ArenaBlock *block = threadArena.block;
+  if (block && block->references.load(std::memory_order_acquire) == 1)
+    block->used = 0;
+
+  size_t offset = block ? (block->used + alignment - 1) & ~(alignment - 1) : 0;
+  if (!block || offset + needed > block->size) {
+    if (needed > allocator->arenaBlockSize)
+      return nullptr;
+    ArenaBlock *next = createBlock(allocator->arenaBlockSize);
+    if (!next)
+      return nullptr;
+    if (block)
+      releaseBlock(block);
+    threadArena.block = block = next;
+    offset = 0;
+  }
+
+  char *memory = block->base + offset + space;
+  block->used = offset + needed;
+  block->references.fetch_add(1, std::memory_order_relaxed);
+
+  AllocationHeader *header = getHeader(memory);
+  header->block = block;
+  header->offset = (uint32_t)space;
+  return memory;
+}
+
+static void *allocateFromHeap(size_t size, size_t alignment) {
+  size_t space = headerSpace(alignment);
+  void *base = nullptr;
+  if (posix_memalign(&base, alignment, space + size) != 0)
+    return nullptr;
+
+  char *memory = (char *)base + space;
+  AllocationHeader *header = getHeader(memory);
+  header->block = nullptr;
+  header->offset = (uint32_t)space;
+  return memory;
+}
+
+static void countAllocation(HostAllocationScopeCounters &counters, uint64_t size) {
+  counters.allocations.fetch_add(1, std::memory_order_relaxed);
+  counters.totalBytes.fetch_add(size, std::memory_order_relaxed);
+  uint64_t live = counters.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+  uint64_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+  while (live > peak &&
+         !counters.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+static void *VKAPI_CALL hostAllocation(void *userData, size_t size, size_t alignment,
+                                       VkSystemAllocationScope scope) {
+  HostAllocator *allocator = (HostAllocator *)userData;
+  if (size == 0)
+    return nullptr;
+  // posix_memalign wants at least pointer alignment
+  alignment = std::max(alignment, sizeof(void *));
+
+  void *memory = nullptr;
+  bool fromArena = false;
+  // blocks are only 64-byte aligned, larger alignments go to the heap
+  if (allocator->arena && scope == VK_SYSTEM_ALLOCATION_SCOPE_OBJECT && alignment <= 64) {
+    memory = allocateFromArena(allocator, size, alignment);
+    fromArena = memory != nullptr;
+  }
+  if (!memory)
+    memory = allocateFromHeap(size, alignment);
+  if (!memory)
+    return nullptr;
+
+  AllocationHeader *header = getHeader(memory);
+  header->size = size;
+  header->scope = (uint32_t)scope;
+
+  HostAllocationScopeCounters &counters = allocator->scopes[scope];
+  countAllocation(counters, size);
+  if (fromArena)
+    counters.arenaAllocations.fetch_add(1, std::memory_order_relaxed);
+  return memory;
+}
+
+static void VKAPI_CALL hostFree(void *userData, void *memory) {
+  if (!memory)
+    return;
+
+  HostAllocator *allocator = (HostAllocator *)userData;
+  AllocationHeader *header = getHeader(memory);
+  HostAllocationScopeCounters &counters = allocator->scopes[header->scope];
+  counters.frees.fetch_add(1, std::memory_order_relaxed);
+  counters.liveBytes.fetch_sub(header->size, std::memory_order_relaxed);
+
+  if (header->block)
+    releaseBlock(header->block);
+  else
+    free((char *)memory - header->offset);
+}
+
+static void *VKAPI_CALL hostReallocation(void *userData, void *original, size_t size,
+                                         size_t alignment, VkSystemAllocationScope scope) {
+  if (!original)
+    return hostAllocation(userData, size, alignment, scope);
+  if (size == 0) {
+    hostFree(userData, original);
+    return nullptr;
+  }
+
+  HostAllocator *allocator = (HostAllocator *)userData;
+  void *memory = hostAllocation(userData, size, alignment, scope);
+  if (!memory)
+    return nullptr;
+
+  // counted as a reallocation rather than a fresh allocation plus a free
+  HostAllocationScopeCounters &counters = allocator->scopes[scope];
+  counters.allocations.fetch_sub(1, std::memory_order_relaxed);
+  counters.reallocations.fetch_add(1, std::memory_order_relaxed);
+  HostAllocationScopeCounters &originalCounters = allocator->scopes[getHeader(original)->scope];
+
+  memcpy(memory, original, std::min<size_t>(size, getHeader(original)->size));
+  hostFree(userData, original);
+  originalCounters.frees.fetch_sub(1, std::memory_order_relaxed);
+  return memory;
+}
+
+HostAllocator *createHostAllocator(bool arena) {
+  HostAllocator *allocator = new HostAllocator();
+  allocator->arena = arena;
+  allocator->id = nextHostAllocatorId.fetch_add(1);
+  allocator->callbacks.pUserData = allocator;
+  allocator->callbacks.pfnAllocation = hostAllocation;
+  allocator->callbacks.pfnReallocation = hostReallocation;
+  allocator->callbacks.pfnFree = hostFree;
+  allocator->callbacks.pfnInternalAllocation = nullptr;
+  allocator->callbacks.pfnInternalFree = nullptr;
+  return allocator;
+}
+
+HostAllocatorStats getHostAllocatorStats(HostAllocator *allocator) {
+  HostAllocatorStats stats = {};
+  if (!allocator)
+    return stats;
+
+  for (uint32_t i = 0; i < HostAllocationScopeCount; i++) {
+    HostAllocationScopeCounters &counters = allocator->scopes[i];
+    stats.scopes[i].allocations = counters.allocations.load(std::memory_order_relaxed);
+    stats.scopes[i].reallocations = counters.reallocations.load(std::memory_order_relaxed);
+    stats.scopes[i].frees = counters.frees.load(std::memory_order_relaxed);
+    stats.scopes[i].totalBytes = counters.totalBytes.load(std::memory_order_relaxed);
+    stats.scopes[i].liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+    stats.scopes[i].peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    stats.scopes[i].arenaAllocations = counters.arenaAllocations.load(std::memory_order_relaxed);
+  }
+  return stats;
+}
+
+HostAllocatorStats diffHostAllocatorStats(const HostAllocatorStats &before,
+                                          const HostAllocatorStats &after) {
+  HostAllocatorStats diff = after;
+  for (uint32_t i = 0; i < HostAllocationScopeCount; i++) {
+    diff.scopes[i].allocations -= before.scopes[i].allocations;
+    diff.scopes[i].reallocations -= before.scopes[i].reallocations;
+    diff.scopes[i].frees -= before.scopes[i].frees;
+    diff.scopes[i].totalBytes -= before.scopes[i].totalBytes;
+    diff.scopes[i].arenaAllocations -= before.scopes[i].arenaAllocations;
+  }
+  return diff;
+}
+
+void printHostAllocatorStats(const HostAllocatorStats &stats, const char *label) {
+  printf("host allocations %s:\n", label);
+  for (uint32_t i = 0; i < HostAllocationScopeCount; i++) {
+    const HostAllocationScopeStats &scope = stats.scopes[i];
+    if (scope.allocations == 0 && scope.reallocations == 0 && scope.frees == 0 &&
+        scope.liveBytes == 0)
+      continue;
+    printf("  %-8s %8" PRIu64 " allocs %6" PRIu64 " reallocs %8" PRIu64 " frees %10" PRIu64
+           " bytes, %10" PRIu64 " live, %10" PRIu64 " peak, %8" PRIu64 " from arena\n",
+           scopeNames[i], scope.allocations, scope.reallocations, scope.frees, scope.totalBytes,
+           scope.liveBytes, scope.peakBytes, scope.arenaAllocations);
+  }
+}
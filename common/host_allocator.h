@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include "volk/volk.h"
+
+// VkAllocationCallbacks that count what the driver allocates per
+// VkSystemAllocationScope. In arena mode object-scope allocations are bumped
+// out of a per-thread block instead of going to malloc; a block is recycled
+// once everything allocated from it has been freed.
+
+static const uint32_t HostAllocationScopeCount = VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE + 1;
+
+struct HostAllocationScopeCounters {
+  std::atomic<uint64_t> allocations{0};
+  std::atomic<uint64_t> reallocations{0};
+  std::atomic<uint64_t> frees{0};
+  // bytes requested over the allocator's lifetime
+  std::atomic<uint64_t> totalBytes{0};
+  std::atomic<uint64_t> liveBytes{0};
+  std::atomic<uint64_t> peakBytes{0};
+  // allocations served by an arena block
+  std::atomic<uint64_t> arenaAllocations{0};
+};
+
+struct HostAllocator {
+  VkAllocationCallbacks callbacks;
+  HostAllocationScopeCounters scopes[HostAllocationScopeCount];
+  bool arena = false;
+  size_t arenaBlockSize = 1 << 20;
+  // never reused, lets threads cache their arena without a lookup
+  uint64_t id = 0;
+};
+
+// plain copy of the counters, subtract two to get the churn of one case
+struct HostAllocationScopeStats {
+  uint64_t allocations;
+  uint64_t reallocations;
+  uint64_t frees;
+  uint64_t totalBytes;
+  uint64_t liveBytes;
+  uint64_t peakBytes;
+  uint64_t arenaAllocations;
+};
+
+struct HostAllocatorStats {
+  HostAllocationScopeStats scopes[HostAllocationScopeCount];
+};
+
+// the allocator has to outlive every object created with it, so there is no
+// matching destroy while the instance and device are never destroyed
+HostAllocator *createHostAllocator(bool arena);
+HostAllocatorStats getHostAllocatorStats(HostAllocator *allocator);
+// peak and live bytes are taken from `after`, the counts are differences
+HostAllocatorStats diffHostAllocatorStats(const HostAllocatorStats &before,
+                                          const HostAllocatorStats &after);
+void printHostAllocatorStats(const HostAllocatorStats &stats, const char *label);
@@ -0,0 +1,271 @@
+#include <algorithm>
+#include <chrono>
+#include "memory_allocator.h"
+
+static const VkDeviceSize MinNodeSize = 256;
+
+static VkDeviceSize nextPowerOfTwo(VkDeviceSize value) {
+  VkDeviceSize result = 1;
+  while (result < value)
+    result <<= 1;
+  return result;
+}
+
+static uint32_t orderForSize(MemoryAllocator &allocator, VkDeviceSize size) {
+  uint32_t order = 0;
+  while ((allocator.minNodeSize << order) < size)
+    ++order;
+  return order;
+}
+
+void createMemoryAllocator(Context &context, MemoryAllocator &allocator,
+                           VkDeviceSize blockSize) {
+  VkPhysicalDeviceProperties properties;
+  vkGetPhysicalDeviceProperties(context.physicalDevice, &properties);
+
+  allocator.context = &context;
+  // buddies of different resource types may share a page, so never hand out
+  // nodes smaller than bufferImageGranularity
+  allocator.minNodeSize = nextPowerOfTwo(
+      std::max(MinNodeSize, properties.limits.bufferImageGranularity));
+  allocator.blockSize = nextPowerOfTwo(std::max(blockSize, allocator.minNodeSize));
+  allocator.maxOrder = orderForSize(allocator, allocator.blockSize);
+  allocator.pools.clear();
+  allocator.pools.resize(context.memoryProperties.memoryTypeCount);
+}
+
+void destroyMemoryAllocator(MemoryAllocator &allocator) {
+  Context &context = *allocator.context;
+  for (MemoryPool &pool : allocator.pools) {
+    if (pool.allocationCount != 0)
+      fprintf(stderr, "WARNING %llu sub-allocations leaked\n",
+              (unsigned long long)pool.allocationCount);
+    for (MemoryBlock &block : pool.blocks) {
+      if (block.mapped)
+        context.deviceTable.vkUnmapMemory(context.device, block.memory);
+      context.deviceTable.vkFreeMemory(context.device, block.memory, context.allocationCallbacks);
+    }
+  }
+  if (allocator.dedicatedAllocationCount != 0)
+    fprintf(stderr, "WARNING %llu dedicated allocations leaked\n",
+            (unsigned long long)allocator.dedicatedAllocationCount);
+  allocator.pools.clear();
+}
+
+static bool isHostVisible(Context &context, uint32_t memoryTypeIndex) {
+  return (context.memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags &
+          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
+}
+
+static VkDeviceMemory allocateDeviceMemory(Context &context, VkDeviceSize size,
+                                           uint32_t memoryTypeIndex,
+                                           void **mapped) {
+  VkMemoryAllocateInfo allocateInfo;
+  allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+  allocateInfo.allocationSize = size;
+  allocateInfo.memoryTypeIndex = memoryTypeIndex;
+  allocateInfo.pNext = nullptr;
+
+  VkDeviceMemory memory;
+  VULKAN_CHECK(context.deviceTable.vkAllocateMemory(context.device, &allocateInfo,
+                                                    context.allocationCallbacks, &memory));
+
+  *mapped = nullptr;
+  if (isHostVisible(context, memoryTypeIndex))
+    VULKAN_CHECK(context.deviceTable.vkMapMemory(context.device, memory, 0,
+                                                 VK_WHOLE_SIZE, 0, mapped));
+  return memory;
+}
+
+static bool allocateFromBlock(MemoryAllocator &allocator, MemoryBlock &block,
+                              uint32_t order, VkDeviceSize &offset) {
+  uint32_t available = order;
+  while (available <= allocator.maxOrder && block.freeLists[available].empty())
+    ++available;
+  if (available > allocator.maxOrder)
+    return false;
+
+  std::unordered_set<VkDeviceSize> &freeList = block.freeLists[available];
+  offset = *freeList.begin();
+  freeList.erase(freeList.begin());
+
+  // split down, keeping the lower half and freeing the upper buddy
+  while (available > order) {
+    --available;
+    block.freeLists[available].insert(offset + (allocator.minNodeSize << available));
+  }
+  block.freeBytes -= allocator.minNodeSize << order;
+  return true;
+}
+
+void allocateMemory(MemoryAllocator &allocator,
+                    const VkMemoryRequirements &requirements,
+                    VkMemoryPropertyFlags propertyFlags,
+                    MemoryAllocation &allocation) {
+  auto start = std::chrono::steady_clock::now();
+  Context &context = *allocator.context;
+
+  allocation = MemoryAllocation();
+  allocation.memoryTypeIndex =
+      getMemoryTypeIndex(context, requirements.memoryTypeBits, propertyFlags);
+  allocation.size = requirements.size;
+
+  std::lock_guard<std::mutex> lock(allocator.mutex);
+
+  // nodes are aligned to their own size, which covers any power-of-two alignment
+  VkDeviceSize nodeSize = nextPowerOfTwo(
+      std::max(std::max(requirements.size, requirements.alignment),
+               allocator.minNodeSize));
+
+  if (nodeSize > allocator.blockSize) {
+    allocation.dedicated = true;
+    allocation.memory = allocateDeviceMemory(context, requirements.size,
+                                             allocation.memoryTypeIndex,
+                                             &allocation.mapped);
+    allocator.dedicatedAllocationCount++;
+    allocator.dedicatedBytes += requirements.size;
+  } else {
+    MemoryPool &pool = allocator.pools[allocation.memoryTypeIndex];
+    allocation.order = orderForSize(allocator, nodeSize);
+
+    bool found = false;
+    for (uint32_t i = 0; i < pool.blocks.size() && !found; ++i) {
+      if (pool.blocks[i].freeBytes >= nodeSize &&
+          allocateFromBlock(allocator, pool.blocks[i], allocation.order,
+                            allocation.offset)) {
+        allocation.blockIndex = i;
+        found = true;
+      }
+    }
+
+    if (!found) {
+      MemoryBlock block;
+      block.memory = allocateDeviceMemory(context, allocator.blockSize,
+                                          allocation.memoryTypeIndex, &block.mapped);
+      block.freeLists.resize(allocator.maxOrder + 1);
+      block.freeLists[allocator.maxOrder].insert(0);
+      block.freeBytes = allocator.blockSize;
+      pool.blocks.push_back(std::move(block));
+
+      allocation.blockIndex = (uint32_t)pool.blocks.size() - 1;
+      allocateFromBlock(allocator, pool.blocks.back(), allocation.order,
+                        allocation.offset);
+    }
+
+    MemoryBlock &block = pool.blocks[allocation.blockIndex];
+    allocation.memory = block.memory;
+    if (block.mapped)
+      allocation.mapped = (char *)block.mapped + allocation.offset;
+
+    pool.allocationCount++;
+    pool.requestedBytes += requirements.size;
+    pool.reservedBytes += nodeSize;
+  }
+
+  double latencyNs = std::chrono::duration<double, std::nano>(
+                         std::chrono::steady_clock::now() - start).count();
+  allocator.latencySamples++;
+  allocator.totalLatencyNs += latencyNs;
+  allocator.maxLatencyNs = std::max(allocator.maxLatencyNs, latencyNs);
+}
+
+void freeMemory(MemoryAllocator &allocator, MemoryAllocation &allocation) {
+  if (allocation.memory == VK_NULL_HANDLE)
+    return;
+
+  Context &context = *allocator.context;
+  std::lock_guard<std::mutex> lock(allocator.mutex);
+
+  if (allocation.dedicated) {
+    if (allocation.mapped)
+      context.deviceTable.vkUnmapMemory(context.device, allocation.memory);
+    context.deviceTable.vkFreeMemory(context.device, allocation.memory, context.allocationCallbacks);
+    allocator.dedicatedAllocationCount--;
+    allocator.dedicatedBytes -= allocation.size;
+    allocation = MemoryAllocation();
+    return;
+  }
+
+  MemoryPool &pool = allocator.pools[allocation.memoryTypeIndex];
+  MemoryBlock &block = pool.blocks[allocation.blockIndex];
+  VkDeviceSize nodeSize = allocator.minNodeSize << allocation.order;
+  block.freeBytes += nodeSize;
+  pool.allocationCount--;
+  pool.requestedBytes -= allocation.size;
+  pool.reservedBytes -= nodeSize;
+
+  // merge with free buddies as far up as possible
+  VkDeviceSize offset = allocation.offset;
+  uint32_t order = allocation.order;
+  while (order < allocator.maxOrder) {
+    VkDeviceSize buddy = offset ^ (allocator.minNodeSize << order);
+    auto it = block.freeLists[order].find(buddy);
+    if (it == block.freeLists[order].end())
+      break;
+    block.freeLists[order].erase(it);
+    offset = std::min(offset, buddy);
+    ++order;
+  }
+  block.freeLists[order].insert(offset);
+
+  allocation = MemoryAllocation();
+}
+
+MemoryAllocatorStats getMemoryAllocatorStats(MemoryAllocator &allocator) {
+  std::lock_guard<std::mutex> lock(allocator.mutex);
+
+  MemoryAllocatorStats stats;
+  stats.dedicatedAllocationCount = allocator.dedicatedAllocationCount;
+  stats.deviceBytes = allocator.dedicatedBytes;
+  stats.requestedBytes = allocator.dedicatedBytes;
+  stats.reservedBytes = allocator.dedicatedBytes;
+
+  for (MemoryPool &pool : allocator.pools) {
+    stats.allocationCount += pool.allocationCount;
+    stats.blockCount += pool.blocks.size();
+    stats.deviceBytes += pool.blocks.size() * allocator.blockSize;
+    stats.requestedBytes += pool.requestedBytes;
+    stats.reservedBytes += pool.reservedBytes;
+    for (MemoryBlock &block : pool.blocks) {
+      stats.freeBytes += block.freeBytes;
+      for (uint32_t order = allocator.maxOrder + 1; order-- > 0;) {
+        if (!block.freeLists[order].empty()) {
+          stats.largestFreeRange =
+              std::max(stats.largestFreeRange, allocator.minNodeSize << order);
+          break;
+        }
+      }
+    }
+  }
+  stats.allocationCount += stats.dedicatedAllocationCount;
+
+  if (stats.reservedBytes > 0)
+    stats.internalFragmentation =
+        1.0 - (double)stats.requestedBytes / stats.reservedBytes;
+  if (stats.freeBytes > 0)
+    stats.externalFragmentation =
+        1.0 - (double)stats.largestFreeRange / stats.freeBytes;
+
+  stats.latencySamples = allocator.latencySamples;
+  if (allocator.latencySamples > 0)
+    stats.averageLatencyNs = allocator.totalLatencyNs / allocator.latencySamples;
+  stats.maxLatencyNs = allocator.maxLatencyNs;
+  return stats;
+}
+
+void printMemoryAllocatorStats(MemoryAllocator &allocator) {
+  MemoryAllocatorStats stats = getMemoryAllocatorStats(allocator);
+  printf("memory: %llu allocations (%llu dedicated) in %llu blocks, %llu/%llu "
+         "bytes used/reserved of %llu\n",
+         (unsigned long long)stats.allocationCount,
+         (unsigned long long)stats.dedicatedAllocationCount,
+         (unsigned long long)stats.blockCount,
+         (unsigned long long)stats.requestedBytes,
+         (unsigned long long)stats.reservedBytes,
+         (unsigned long long)stats.deviceBytes);
+  printf("memory: fragmentation internal %.1f%% external %.1f%%, allocation "
+         "latency avg %.0f ns max %.0f ns over %llu calls\n",
+         stats.internalFragmentation * 100.0, stats.externalFragmentation * 100.0,
+         stats.averageLatencyNs, stats.maxLatencyNs,
+         (unsigned long long)stats.latencySamples);
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+#include "common.h"
+
+// Buddy sub-allocator over large VkDeviceMemory blocks, one pool per memory
+// type. Requests larger than the block size get a dedicated allocation.
+
+struct MemoryAllocation {
+  VkDeviceMemory memory = (VkDeviceMemory)VK_NULL_HANDLE;
+  VkDeviceSize offset = 0;
+  VkDeviceSize size = 0;
+  // non-null for HOST_VISIBLE memory types, blocks are mapped persistently
+  void *mapped = nullptr;
+  uint32_t memoryTypeIndex = 0;
+  uint32_t blockIndex = 0;
+  uint32_t order = 0;
+  bool dedicated = false;
+};
+
+struct MemoryBlock {
+  VkDeviceMemory memory = (VkDeviceMemory)VK_NULL_HANDLE;
+  void *mapped = nullptr;
+  // free node offsets per order, node size is minNodeSize << order
+  std::vector<std::unordered_set<VkDeviceSize>> freeLists;
+  VkDeviceSize freeBytes = 0;
+};
+
+struct MemoryPool {
+  std::vector<MemoryBlock> blocks;
+  uint64_t allocationCount = 0;
+  VkDeviceSize requestedBytes = 0;
+  VkDeviceSize reservedBytes = 0;
+};
+
+struct MemoryAllocatorStats {
+  uint64_t allocationCount = 0;
+  uint64_t dedicatedAllocationCount = 0;
+  uint64_t blockCount = 0;
+  // bytes obtained from vkAllocateMemory
+  VkDeviceSize deviceBytes = 0;
+  // bytes asked for by callers vs. bytes handed out after power-of-two rounding
+  VkDeviceSize requestedBytes = 0;
+  VkDeviceSize reservedBytes = 0;
+  VkDeviceSize freeBytes = 0;
+  VkDeviceSize largestFreeRange = 0;
+  // 1 - requested/reserved
+  double internalFragmentation = 0.0;
+  // 1 - largestFreeRange/freeBytes
+  double externalFragmentation = 0.0;
+  uint64_t latencySamples = 0;
+  double averageLatencyNs = 0.0;
+  double maxLatencyNs = 0.0;
+};
+
+struct MemoryAllocator {
+  Context *context = nullptr;
+  VkDeviceSize blockSize = 0;
+  VkDeviceSize minNodeSize = 0;
+  uint32_t maxOrder = 0;
+  std::vector<MemoryPool> pools;
+  uint64_t dedicatedAllocationCount = 0;
+  VkDeviceSize dedicatedBytes = 0;
+  uint64_t latencySamples = 0;
+  double totalLatencyNs = 0.0;
+  double maxLatencyNs = 0.0;
+  std::mutex mutex;
+};
+
+void createMemoryAllocator(Context &context, MemoryAllocator &allocator,
+                           VkDeviceSize blockSize = 64ull << 20);
+void destroyMemoryAllocator(MemoryAllocator &allocator);
+
+void allocateMemory(MemoryAllocator &allocator,
+                    const VkMemoryRequirements &requirements,
+                    VkMemoryPropertyFlags propertyFlags,
+                    MemoryAllocation &allocation);
+void freeMemory(MemoryAllocator &allocator, MemoryAllocation &allocation);
+
+MemoryAllocatorStats getMemoryAllocatorStats(MemoryAllocator &allocator);
+void printMemoryAllocatorStats(MemoryAllocator &allocator);
@@ -0,0 +1,311 @@
+#include <math.h>
+#include <string.h>
+#include <unordered_set>
+#include "mutation.h"
+
+static const uint64_t PoisonPointer = 0x1234;
+// non-canonical on x86-64 and outside any arm64 user mapping
+static const uint64_t PoisonHighPointer = 0xFFFFFFFFFFFFF000ull;
+
+static uint64_t floatBits(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+static float bitsFloat(uint64_t value) {
+  uint32_t bits = (uint32_t)value;
+  float result;
+  memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+static std::vector<PoisonField> createPoisonFields() {
+  const std::vector<uint64_t> pointers = {PoisonPointer, PoisonHighPointer};
+  const std::vector<uint64_t> floats = {floatBits(NAN), floatBits(1.0e30f)};
+
+  return {
+    // no tessellation stages in the base pipeline
+    {"pTessellationState", 0, 0, pointers,
+     [](PipelineState &s, uint64_t v) { s.createInfo.pTessellationState = (const VkPipelineTessellationStateCreateInfo *)v; }, true},
+    {"pViewportState", PreconditionRasterizerDiscard, 0, pointers,
+     [](PipelineState &s, uint64_t v) { s.createInfo.pViewportState = (const VkPipelineViewportStateCreateInfo *)v; }, true},
+    {"pMultisampleState", PreconditionRasterizerDiscard, 0, pointers,
+     [](PipelineState &s, uint64_t v) { s.createInfo.pMultisampleState = (const VkPipelineMultisampleStateCreateInfo *)v; }, true},
+    {"pDepthStencilState", PreconditionRasterizerDiscard, 0, pointers,
+     [](PipelineState &s, uint64_t v) { s.createInfo.pDepthStencilState = (const VkPipelineDepthStencilStateCreateInfo *)v; }, true},
+    {"pColorBlendState", PreconditionRasterizerDiscard, 0, pointers,
+     [](PipelineState &s, uint64_t v) { s.createInfo.pColorBlendState = (const VkPipelineColorBlendStateCreateInfo *)v; }, true},
+    // not a derivative pipeline
+    {"basePipelineHandle", 0, 0, {PoisonPointer},
+     [](PipelineState &s, uint64_t v) { s.createInfo.basePipelineHandle = (VkPipeline)v; }, false},
+    {"basePipelineIndex", 0, 0, {0x1234, (uint64_t)(uint32_t)INT32_MIN},
+     [](PipelineState &s, uint64_t v) { s.createInfo.basePipelineIndex = (int32_t)(uint32_t)v; }, false},
+    // zero counts
+    {"pVertexInputState->pVertexBindingDescriptions", 0, 0, pointers,
+     [](PipelineState &s, uint64_t v) { s.vertexInputStateCreateInfo.pVertexBindingDescriptions = (const VkVertexInputBindingDescription *)v; }, true},
+    {"pVertexInputState->pVertexAttributeDescriptions", 0, 0, pointers,
+     [](PipelineState &s, uint64_t v) { s.vertexInputStateCreateInfo.pVertexAttributeDescriptions = (const VkVertexInputAttributeDescription *)v; }, true},
+    {"pDynamicState->pDynamicStates", 0, PreconditionDynamicViewportScissor, pointers,
+     [](PipelineState &s, uint64_t v) { s.dynamicStateCreateInfo.pDynamicStates = (const VkDynamicState *)v; }, true},
+    // dynamic viewport/scissor
+    {"pViewportState->pViewports", PreconditionDynamicViewportScissor, 0, pointers,
+     [](PipelineState &s, uint64_t v) { s.viewportStateCreateInfo.pViewports = (const VkViewport *)v; }, true},
+    {"pViewportState->pScissors", PreconditionDynamicViewportScissor, 0, pointers,
+     [](PipelineState &s, uint64_t v) { s.viewportStateCreateInfo.pScissors = (const VkRect2D *)v; }, true},
+    // depthBiasEnable is VK_FALSE
+    {"pRasterizationState->depthBiasConstantFactor", 0, 0, floats,
+     [](PipelineState &s, uint64_t v) { s.rasterStateCreateInfo.depthBiasConstantFactor = bitsFloat(v); }, false},
+    {"pRasterizationState->depthBiasClamp", 0, 0, floats,
+     [](PipelineState &s, uint64_t v) { s.rasterStateCreateInfo.depthBiasClamp = bitsFloat(v); }, false},
+    {"pRasterizationState->depthBiasSlopeFactor", 0, 0, floats,
+     [](PipelineState &s, uint64_t v) { s.rasterStateCreateInfo.depthBiasSlopeFactor = bitsFloat(v); }, false},
+    // no blend factor uses the constants
+    {"pColorBlendState->blendConstants", 0, 0, floats,
+     [](PipelineState &s, uint64_t v) {
+       for (float &constant : s.colourBlendStateCreateInfo.blendConstants)
+         constant = bitsFloat(v);
+     }, false},
+    // depthBoundsTestEnable is VK_FALSE
+    {"pDepthStencilState->minDepthBounds/maxDepthBounds", 0, 0, floats,
+     [](PipelineState &s, uint64_t v) {
+       s.depthStencilStateCreateInfo.minDepthBounds = bitsFloat(v);
+       s.depthStencilStateCreateInfo.maxDepthBounds = bitsFloat(v);
+     }, false},
+    // sampleShadingEnable is VK_FALSE
+    {"pMultisampleState->minSampleShading", 0, 0, floats,
+     [](PipelineState &s, uint64_t v) { s.multisampleStateCreateInfo.minSampleShading = bitsFloat(v); }, false},
+  };
+}
+
+const std::vector<PoisonField> &getPoisonFields() {
+  static const std::vector<PoisonField> fields = createPoisonFields();
+  return fields;
+}
+
+void initializePipelineState(Context &context, PipelineState &state) {
+  state.shaderStageCreateInfos[0] = context.shaderStageCreateInfos[0];
+  state.shaderStageCreateInfos[1] = context.shaderStageCreateInfos[1];
+  state.colourBlendAttachmentState = context.colourBlendAttachmentState;
+  state.colourBlendStateCreateInfo = context.colourBlendStateCreateInfo;
+  state.depthStencilStateCreateInfo = context.depthStencilStateCreateInfo;
+  state.vertexInputStateCreateInfo = context.vertexInputStateCreateInfo;
+  state.inputAssemblyStateCreateInfo = context.inputAssemblyStateCreateInfo;
+  state.rasterStateCreateInfo = context.rasterStateCreateInfo;
+  state.viewportStateCreateInfo = context.viewportStateCreateInfo;
+  state.multisampleStateCreateInfo = context.multisampleStateCreateInfo;
+  state.dynamicStateCreateInfo = context.dynamicStateCreateInfo;
+  state.dynamicStates[0] = VK_DYNAMIC_STATE_VIEWPORT;
+  state.dynamicStates[1] = VK_DYNAMIC_STATE_SCISSOR;
+  state.viewport = context.viewport;
+  state.scissor = context.scissor;
+  state.createInfo = context.basePipelineCreateInfo;
+
+  state.colourBlendStateCreateInfo.pAttachments = &state.colourBlendAttachmentState;
+  state.viewportStateCreateInfo.pViewports = &state.viewport;
+  state.viewportStateCreateInfo.pScissors = &state.scissor;
+  state.createInfo.pStages = state.shaderStageCreateInfos;
+  state.createInfo.pColorBlendState = &state.colourBlendStateCreateInfo;
+  state.createInfo.pDepthStencilState = &state.depthStencilStateCreateInfo;
+  state.createInfo.pDynamicState = &state.dynamicStateCreateInfo;
+  state.createInfo.pInputAssemblyState = &state.inputAssemblyStateCreateInfo;
+  state.createInfo.pMultisampleState = &state.multisampleStateCreateInfo;
+  state.createInfo.pRasterizationState = &state.rasterStateCreateInfo;
+  state.createInfo.pVertexInputState = &state.vertexInputStateCreateInfo;
+  state.createInfo.pViewportState = &state.viewportStateCreateInfo;
+}
+
+void applyPreconditions(uint32_t preconditions, PipelineState &state) {
+  if (preconditions & PreconditionRasterizerDiscard)
+    state.rasterStateCreateInfo.rasterizerDiscardEnable = VK_TRUE;
+  if (preconditions & PreconditionDynamicViewportScissor) {
+    state.dynamicStateCreateInfo.dynamicStateCount = 2;
+    state.dynamicStateCreateInfo.pDynamicStates = state.dynamicStates;
+  }
+}
+
+void applyMutation(const Mutation &mutation, PipelineState &state) {
+  applyPreconditions(mutation.preconditions, state);
+
+  const std::vector<PoisonField> &fields = getPoisonFields();
+  for (const Poison &poison : mutation.poisons) {
+    const PoisonField &field = fields[poison.field];
+    field.apply(state, field.values[poison.value]);
+  }
+}
+
+// FNV-1a
+static void hashBytes(uint64_t &hash, const void *data, size_t size) {
+  const unsigned char *bytes = (const unsigned char *)data;
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ull;
+  }
+}
+
+template <typename T> static void hashValue(uint64_t &hash, const T &value) {
+  hashBytes(hash, &value, sizeof(value));
+}
+
+// pointers into the state are followed by the caller; anything else is
+// poison and is hashed by value
+template <typename T>
+static bool hashPointer(uint64_t &hash, const T *pointer, const T *expected) {
+  bool follow = pointer == expected;
+  hashValue(hash, follow ? (uintptr_t)0 : (uintptr_t)pointer);
+  return follow;
+}
+
+uint64_t hashPipelineState(const PipelineState &state) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  const VkGraphicsPipelineCreateInfo &createInfo = state.createInfo;
+
+  hashValue(hash, createInfo.flags);
+  hashValue(hash, createInfo.stageCount);
+  hashValue(hash, createInfo.basePipelineHandle);
+  hashValue(hash, createInfo.basePipelineIndex);
+  hashPointer(hash, createInfo.pTessellationState,
+              (const VkPipelineTessellationStateCreateInfo *)nullptr);
+
+  const VkPipelineRasterizationStateCreateInfo &raster = state.rasterStateCreateInfo;
+  hashValue(hash, raster.rasterizerDiscardEnable);
+  hashValue(hash, raster.depthBiasConstantFactor);
+  hashValue(hash, raster.depthBiasClamp);
+  hashValue(hash, raster.depthBiasSlopeFactor);
+
+  const VkPipelineVertexInputStateCreateInfo &vertexInput = state.vertexInputStateCreateInfo;
+  hashPointer(hash, vertexInput.pVertexBindingDescriptions,
+              (const VkVertexInputBindingDescription *)nullptr);
+  hashPointer(hash, vertexInput.pVertexAttributeDescriptions,
+              (const VkVertexInputAttributeDescription *)nullptr);
+
+  const VkPipelineDynamicStateCreateInfo &dynamicState = state.dynamicStateCreateInfo;
+  hashValue(hash, dynamicState.dynamicStateCount);
+  if (hashPointer(hash, dynamicState.pDynamicStates,
+                  dynamicState.dynamicStateCount ? state.dynamicStates : nullptr))
+    hashBytes(hash, state.dynamicStates,
+              dynamicState.dynamicStateCount * sizeof(VkDynamicState));
+
+  if (hashPointer(hash, createInfo.pViewportState, &state.viewportStateCreateInfo)) {
+    const VkPipelineViewportStateCreateInfo &viewportState = state.viewportStateCreateInfo;
+    if (hashPointer(hash, viewportState.pViewports, &state.viewport))
+      hashValue(hash, state.viewport);
+    if (hashPointer(hash, viewportState.pScissors, &state.scissor))
+      hashValue(hash, state.scissor);
+  }
+
+  if (hashPointer(hash, createInfo.pMultisampleState, &state.multisampleStateCreateInfo))
+    hashValue(hash, state.multisampleStateCreateInfo.minSampleShading);
+
+  if (hashPointer(hash, createInfo.pDepthStencilState, &state.depthStencilStateCreateInfo)) {
+    hashValue(hash, state.depthStencilStateCreateInfo.minDepthBounds);
+    hashValue(hash, state.depthStencilStateCreateInfo.maxDepthBounds);
+  }
+
+  if (hashPointer(hash, createInfo.pColorBlendState, &state.colourBlendStateCreateInfo))
+    hashValue(hash, state.colourBlendStateCreateInfo.blendConstants);
+
+  return hash;
+}
+
+std::string describeMutation(const Mutation &mutation) {
+  const std::vector<PoisonField> &fields = getPoisonFields();
+  std::string description;
+  if (mutation.preconditions & PreconditionRasterizerDiscard)
+    description += "[rasterizerDiscardEnable] ";
+  if (mutation.preconditions & PreconditionDynamicViewportScissor)
+    description += "[dynamic viewport/scissor] ";
+
+  char value[32];
+  for (const Poison &poison : mutation.poisons) {
+    const PoisonField &field = fields[poison.field];
+    snprintf(value, sizeof(value), "0x%llx",
+             (unsigned long long)field.values[poison.value]);
+    description += field.name;
+    description += "=";
+    description += value;
+    description += " ";
+  }
+  if (!description.empty())
+    description.pop_back();
+  return description;
+}
+
+std::vector<Mutation> generateMutations(Context &context, uint32_t maxFields,
+                                        size_t maxMutations) {
+  const std::vector<PoisonField> &fields = getPoisonFields();
+  const uint32_t fieldCount = (uint32_t)fields.size();
+
+  std::vector<Mutation> mutations;
+  std::unordered_set<uint64_t> hashes;
+  PipelineState state;
+
+  for (uint32_t k = 1; k <= maxFields && k <= fieldCount; ++k) {
+    // combinations of k field indices in lexicographic order
+    std::vector<uint32_t> indices(k);
+    for (uint32_t i = 0; i < k; ++i)
+      indices[i] = i;
+
+    for (;;) {
+      uint32_t required = 0, forbidden = 0;
+      for (uint32_t index : indices) {
+        required |= fields[index].requiredPreconditions;
+        forbidden |= fields[index].forbiddenPreconditions;
+      }
+
+      if ((required & forbidden) == 0) {
+        // odometer over every poison value of every selected field
+        std::vector<uint32_t> values(k, 0);
+        for (;;) {
+          Mutation mutation;
+          mutation.preconditions = required;
+          for (uint32_t i = 0; i < k; ++i)
+            mutation.poisons.push_back({indices[i], values[i]});
+
+          initializePipelineState(context, state);
+          applyMutation(mutation, state);
+          mutation.stateHash = hashPipelineState(state);
+          if (hashes.insert(mutation.stateHash).second) {
+            mutations.push_back(std::move(mutation));
+            if (mutations.size() >= maxMutations)
+              return mutations;
+          }
+
+          uint32_t i = 0;
+          while (i < k && ++values[i] == fields[indices[i]].values.size())
+            values[i++] = 0;
+          if (i == k)
+            break;
+        }
+      }
+
+      int i = (int)k - 1;
+      while (i >= 0 && indices[i] == fieldCount - k + i)
+        --i;
+      if (i < 0)
+        break;
+      ++indices[i];
+      for (uint32_t j = i + 1; j < k; ++j)
+        indices[j] = indices[j - 1] + 1;
+    }
+  }
+  return mutations;
+}
+
+MutationBatch runMutations(Context &context, const std::vector<Mutation> &mutations,
+                           uint32_t threadCount) {
+  MutationBatch batch;
+  std::vector<VkGraphicsPipelineCreateInfo> createInfos;
+  createInfos.reserve(mutations.size());
+
+  for (const Mutation &mutation : mutations) {
+    batch.states.emplace_back(new PipelineState);
+    PipelineState &state = *batch.states.back();
+    initializePipelineState(context, state);
+    applyMutation(mutation, state);
+    createInfos.push_back(state.createInfo);
+  }
+
+  batch.stats = compilePipelineVariants(context, createInfos, threadCount);
+  return batch;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "common.h"
+#include "pipeline_variants.h"
+
+// Self-contained copy of the Context pipeline state; createInfo points into
+// this object, so it must not be moved once initialized.
+struct PipelineState {
+  VkPipelineShaderStageCreateInfo shaderStageCreateInfos[2];
+  VkPipelineColorBlendAttachmentState colourBlendAttachmentState;
+  VkPipelineColorBlendStateCreateInfo colourBlendStateCreateInfo;
+  VkPipelineDepthStencilStateCreateInfo depthStencilStateCreateInfo;
+  VkPipelineVertexInputStateCreateInfo vertexInputStateCreateInfo;
+  VkPipelineInputAssemblyStateCreateInfo inputAssemblyStateCreateInfo;
+  VkPipelineRasterizationStateCreateInfo rasterStateCreateInfo;
+  VkPipelineViewportStateCreateInfo viewportStateCreateInfo;
+  VkPipelineMultisampleStateCreateInfo multisampleStateCreateInfo;
+  VkPipelineDynamicStateCreateInfo dynamicStateCreateInfo;
+  VkDynamicState dynamicStates[2];
+  VkViewport viewport;
+  VkRect2D scissor;
+  VkGraphicsPipelineCreateInfo createInfo;
+
+  PipelineState() = default;
+  PipelineState(const PipelineState &) = delete;
+  PipelineState &operator=(const PipelineState &) = delete;
+};
+
+// valid state changes that make further fields ignored per spec
+enum MutationPrecondition : uint32_t {
+  PreconditionRasterizerDiscard = 1 << 0,
+  PreconditionDynamicViewportScissor = 1 << 1,
+};
+
+// a field the spec says is ignored once its preconditions hold
+struct PoisonField {
+  const char *name;
+  uint32_t requiredPreconditions;
+  uint32_t forbiddenPreconditions;
+  std::vector<uint64_t> values;
+  void (*apply)(PipelineState &state, uint64_t value);
+  // when the field is a pointer, poison values may be replaced by the caller
+  // (e.g. with guard pages)
+  bool isPointer;
+};
+
+struct Poison {
+  uint32_t field;
+  uint32_t value;
+};
+
+struct Mutation {
+  std::vector<Poison> poisons;
+  uint32_t preconditions = 0;
+  uint64_t stateHash = 0;
+};
+
+const std::vector<PoisonField> &getPoisonFields();
+
+void initializePipelineState(Context &context, PipelineState &state);
+void applyPreconditions(uint32_t preconditions, PipelineState &state);
+void applyMutation(const Mutation &mutation, PipelineState &state);
+// hash of everything the driver may legitimately read; poisoned pointers are
+// hashed by value and never followed
+uint64_t hashPipelineState(const PipelineState &state);
+std::string describeMutation(const Mutation &mutation);
+
+// Every combination of up to maxFields poisoned fields and their poison
+// values, minus invalid precondition sets and duplicates by state hash.
+std::vector<Mutation> generateMutations(Context &context, uint32_t maxFields,
+                                        size_t maxMutations = SIZE_MAX);
+
+struct MutationBatch {
+  std::vector<std::unique_ptr<PipelineState>> states;
+  PipelineVariantStats stats;
+};
+
+MutationBatch runMutations(Context &context, const std::vector<Mutation> &mutations,
+                           uint32_t threadCount);
@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include "pipeline_variants.h"
+
+static void compileBatch(Context &context, VkPipelineCache pipelineCache,
+                         const VkGraphicsPipelineCreateInfo *createInfos,
+                         PipelineVariantResult *results, uint32_t count,
+                         uint32_t threadIndex) {
+  std::vector<VkGraphicsPipelineCreateInfo> batch(createInfos, createInfos + count);
+  std::vector<VkPipelineCreationFeedbackEXT> feedbacks(count);
+  std::vector<VkPipelineCreationFeedbackCreateInfoEXT> feedbackCreateInfos(count);
+  std::vector<VkPipeline> pipelines(count, (VkPipeline)VK_NULL_HANDLE);
+
+  if (context.pipelineCreationFeedback) {
+    for (uint32_t i = 0; i < count; ++i) {
+      VkPipelineCreationFeedbackCreateInfoEXT &feedbackCreateInfo = feedbackCreateInfos[i];
+      feedbackCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT;
+      feedbackCreateInfo.pNext = batch[i].pNext;
+      feedbackCreateInfo.pPipelineCreationFeedback = &feedbacks[i];
+      feedbackCreateInfo.pipelineStageCreationFeedbackCount = 0;
+      feedbackCreateInfo.pPipelineStageCreationFeedbacks = nullptr;
+      feedbacks[i].flags = 0;
+      feedbacks[i].duration = 0;
+      batch[i].pNext = &feedbackCreateInfo;
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  VULKAN_CHECK(context.deviceTable.vkCreateGraphicsPipelines(
+      context.device, pipelineCache, count, batch.data(), context.allocationCallbacks,
+      pipelines.data()));
+  double batchMs = std::chrono::duration<double, std::milli>(
+                       std::chrono::steady_clock::now() - start).count();
+
+  for (uint32_t i = 0; i < count; ++i) {
+    PipelineVariantResult &result = results[i];
+    result.pipeline = pipelines[i];
+    result.threadIndex = threadIndex;
+    result.latencyFromFeedback =
+        context.pipelineCreationFeedback &&
+        (feedbacks[i].flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT);
+    result.latencyMs = result.latencyFromFeedback
+                           ? feedbacks[i].duration / 1.0e6
+                           : batchMs / count;
+  }
+}
+
+PipelineVariantStats compilePipelineVariants(
+    Context &context, const std::vector<VkGraphicsPipelineCreateInfo> &createInfos,
+    uint32_t threadCount, VkPipelineCache pipelineCache) {
+  PipelineVariantStats stats;
+  stats.variants.resize(createInfos.size());
+  stats.threadCount = std::max(1u, std::min(threadCount, (uint32_t)createInfos.size()));
+  if (createInfos.empty())
+    return stats;
+
+  std::vector<std::thread> threads;
+  uint32_t total = (uint32_t)createInfos.size();
+  uint32_t first = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t t = 0; t < stats.threadCount; ++t) {
+    // spread the remainder over the first threads
+    uint32_t count = total / stats.threadCount + (t < total % stats.threadCount ? 1 : 0);
+    threads.emplace_back(compileBatch, std::ref(context), pipelineCache,
+                         createInfos.data() + first, stats.variants.data() + first,
+                         count, t);
+    first += count;
+  }
+  for (std::thread &thread : threads)
+    thread.join();
+
+  stats.wallTimeMs = std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - start).count();
+  stats.pipelinesPerSecond = total / (stats.wallTimeMs / 1000.0);
+  return stats;
+}
+
+void destroyPipelineVariants(Context &context, PipelineVariantStats &stats) {
+  for (PipelineVariantResult &result : stats.variants) {
+    context.deviceTable.vkDestroyPipeline(context.device, result.pipeline, context.allocationCallbacks);
+    result.pipeline = VK_NULL_HANDLE;
+  }
+}
+
+void printPipelineVariantStats(const PipelineVariantStats &stats) {
+  for (size_t i = 0; i < stats.variants.size(); ++i) {
+    const PipelineVariantResult &result = stats.variants[i];
+    printf("variant %zu thread %u: %.3f ms%s\n", i, result.threadIndex,
+           result.latencyMs, result.latencyFromFeedback ? "" : " (batch average)");
+  }
+  printf("%zu pipelines on %u threads in %.3f ms: %.1f pipelines/s\n",
+         stats.variants.size(), stats.threadCount, stats.wallTimeMs,
+         stats.pipelinesPerSecond);
+}
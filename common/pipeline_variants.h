@@ -0,0 +1,30 @@
+#pragma once
+
+#include <vector>
+#include "common.h"
+
+struct PipelineVariantResult {
+  VkPipeline pipeline = (VkPipeline)VK_NULL_HANDLE;
+  // compile time of this variant; taken from VK_EXT_pipeline_creation_feedback
+  // when available, otherwise the batch time divided by the batch size
+  double latencyMs = 0.0;
+  bool latencyFromFeedback = false;
+  uint32_t threadIndex = 0;
+};
+
+struct PipelineVariantStats {
+  std::vector<PipelineVariantResult> variants;
+  uint32_t threadCount = 0;
+  double wallTimeMs = 0.0;
+  double pipelinesPerSecond = 0.0;
+};
+
+// Compiles every create info (typically mutated copies of
+// context.basePipelineCreateInfo) on threadCount worker threads, one batched
+// vkCreateGraphicsPipelines call per thread. Pass VK_NULL_HANDLE as the cache
+// to measure cold compilation.
+PipelineVariantStats compilePipelineVariants(
+    Context &context, const std::vector<VkGraphicsPipelineCreateInfo> &createInfos,
+    uint32_t threadCount, VkPipelineCache pipelineCache = VK_NULL_HANDLE);
+void destroyPipelineVariants(Context &context, PipelineVariantStats &stats);
+void printPipelineVariantStats(const PipelineVariantStats &stats);
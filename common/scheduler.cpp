@@ -0,0 +1,412 @@
+#include <errno.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <new>
+#include <thread>
+#include "fork_server.h"
+#include "scheduler.h"
+
+// Lives in a MAP_SHARED mapping so the parent and every worker see it.
+// Lock-free atomics are address-free, which makes them safe across processes.
+struct WorkQueue {
+  std::atomic<int> lock;
+  int head;
+  int tail;
+  // sum of the estimates still queued, used to pick a victim to steal from
+  double remainingMs;
+};
+
+struct WorkerSlot {
+  pid_t pid;
+  // case index being run, -1 when idle
+  std::atomic<int> current;
+  std::atomic<int64_t> caseStartNs;
+  int casesRun;
+  int casesStolen;
+  double busyMs;
+  // case the parent killed the worker for, -1 if none
+  int timedOutCase;
+};
+
+struct CaseSlot {
+  double estimateMs;
+  ZooCaseStatus status;
+  int code;
+  double ms;
+  int worker;
+};
+
+struct SharedState {
+  int workerCount;
+  int caseCount;
+  WorkQueue *queues;
+  // workerCount * caseCount, each queue owns one row
+  int *items;
+  WorkerSlot *workers;
+  CaseSlot *cases;
+};
+
+static int64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+static void lockQueue(WorkQueue &queue) {
+  while (queue.lock.exchange(1, std::memory_order_acquire))
+    sched_yield();
+}
+
+static void unlockQueue(WorkQueue &queue) {
+  queue.lock.store(0, std::memory_order_release);
+}
+
+static size_t sharedStateSize(int workerCount, int caseCount) {
+  return sizeof(WorkQueue) * workerCount + sizeof(WorkerSlot) * workerCount +
+         sizeof(CaseSlot) * caseCount + sizeof(int) * workerCount * caseCount;
+}
+
+static SharedState createSharedState(int workerCount, int caseCount) {
+  size_t size = sharedStateSize(workerCount, caseCount);
+  void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (memory == MAP_FAILED) {
+    perror("mmap");
+    abort();
+  }
+
+  SharedState state;
+  state.workerCount = workerCount;
+  state.caseCount = caseCount;
+  // every element type is at most 8-byte aligned; keep the int array last
+  char *cursor = (char *)memory;
+  state.queues = (WorkQueue *)cursor;
+  cursor += sizeof(WorkQueue) * workerCount;
+  state.workers = (WorkerSlot *)cursor;
+  cursor += sizeof(WorkerSlot) * workerCount;
+  state.cases = (CaseSlot *)cursor;
+  cursor += sizeof(CaseSlot) * caseCount;
+  state.items = (int *)cursor;
+
+  for (int i = 0; i < workerCount; i++) {
+    WorkQueue *queue = new (&state.queues[i]) WorkQueue();
+    queue->lock.store(0);
+    WorkerSlot *worker = new (&state.workers[i]) WorkerSlot();
+    worker->current.store(-1);
+    worker->caseStartNs.store(0);
+  }
+  for (int i = 0; i < caseCount; i++) {
+    state.cases[i] = {};
+    state.cases[i].status = ZooCaseStatus::NotRun;
+    state.cases[i].worker = -1;
+  }
+  return state;
+}
+
+static void destroySharedState(SharedState &state) {
+  munmap(state.queues, sharedStateSize(state.workerCount, state.caseCount));
+}
+
+// Longest processing time first: deal each case, longest estimate first, to
+// the worker with the least work so far. Every queue ends up sorted longest
+// first.
+static void distributeCases(SharedState &state) {
+  std::vector<int> order(state.caseCount);
+  for (int i = 0; i < state.caseCount; i++)
+    order[i] = i;
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+    return state.cases[a].estimateMs > state.cases[b].estimateMs;
+  });
+
+  for (int index : order) {
+    WorkQueue *lightest = &state.queues[0];
+    for (int i = 1; i < state.workerCount; i++) {
+      if (state.queues[i].remainingMs < lightest->remainingMs)
+        lightest = &state.queues[i];
+    }
+    int row = (int)(lightest - state.queues);
+    state.items[row * state.caseCount + lightest->tail++] = index;
+    lightest->remainingMs += state.cases[index].estimateMs;
+  }
+}
+
+static int popCase(SharedState &state, int row) {
+  WorkQueue &queue = state.queues[row];
+  int index = -1;
+  lockQueue(queue);
+  if (queue.head < queue.tail) {
+    index = state.items[row * state.caseCount + queue.head++];
+    queue.remainingMs -= state.cases[index].estimateMs;
+  }
+  unlockQueue(queue);
+  return index;
+}
+
+static int takeCase(SharedState &state, int worker) {
+  int index = popCase(state, worker);
+  if (index >= 0)
+    return index;
+
+  // steal the longest case left on the most loaded worker; like the initial
+  // deal this keeps the largest remaining job from landing last
+  for (;;) {
+    int victim = -1;
+    double mostRemaining = 0.0;
+    for (int i = 0; i < state.workerCount; i++) {
+      WorkQueue &queue = state.queues[i];
+      lockQueue(queue);
+      bool pending = queue.head < queue.tail;
+      double remaining = queue.remainingMs;
+      unlockQueue(queue);
+      if (pending && (victim < 0 || remaining > mostRemaining)) {
+        victim = i;
+        mostRemaining = remaining;
+      }
+    }
+    if (victim < 0)
+      return -1;
+
+    index = popCase(state, victim);
+    if (index >= 0) {
+      state.workers[worker].casesStolen++;
+      return index;
+    }
+  }
+}
+
+// puts a case the worker never got to finish back in front of a queue; every
+// case taken so far advanced some queue's head, so one has room in front
+static void requeueCase(SharedState &state, int index) {
+  for (int i = 0; i < state.workerCount; i++) {
+    WorkQueue &queue = state.queues[i];
+    lockQueue(queue);
+    bool requeued = queue.head > 0;
+    if (requeued) {
+      state.items[i * state.caseCount + --queue.head] = index;
+      queue.remainingMs += state.cases[index].estimateMs;
+    }
+    unlockQueue(queue);
+    if (requeued)
+      return;
+  }
+}
+
+static bool hasPendingCases(SharedState &state) {
+  for (int i = 0; i < state.workerCount; i++) {
+    WorkQueue &queue = state.queues[i];
+    lockQueue(queue);
+    bool pending = queue.head < queue.tail;
+    unlockQueue(queue);
+    if (pending)
+      return true;
+  }
+  return false;
+}
+
+static void runWorker(int argc, const char *argv[], const std::vector<const ZooCase *> &cases,
+                      SharedState &state, int workerIndex) {
+  WorkerSlot &worker = state.workers[workerIndex];
+  Context context(argc, argv);
+  // every worker runs its cases at the same time as the others
+  context.threadBudget = std::max(1u, std::thread::hardware_concurrency() / (uint32_t)state.workerCount);
+  ensureContext(context, RequireDevice | (getZooCaseRequirements(cases) & RequireInstanceMask));
+
+  for (int index; (index = takeCase(state, workerIndex)) >= 0;) {
+    worker.caseStartNs.store(nowNs());
+    worker.current.store(index);
+
+    runZooCase(context, cases[index]);
+
+    CaseSlot &slot = state.cases[index];
+    slot.ms = (nowNs() - worker.caseStartNs.load()) / 1e6;
+    slot.status = ZooCaseStatus::Passed;
+    slot.worker = workerIndex;
+    worker.casesRun++;
+    worker.busyMs += slot.ms;
+    worker.current.store(-1);
+
+    ZooCaseResult result = {cases[index], slot.status, 0, slot.ms};
+    printZooCaseResult(result);
+    fflush(stdout);
+  }
+
+  destroyContext(context);
+}
+
+static pid_t spawnWorker(int argc, const char *argv[], const std::vector<const ZooCase *> &cases,
+                         SharedState &state, int workerIndex) {
+  pid_t pid = forkChild();
+  if (pid == 0) {
+    runWorker(argc, argv, cases, state, workerIndex);
+    exitChild(0);
+  }
+  state.workers[workerIndex].pid = pid;
+  state.workers[workerIndex].timedOutCase = -1;
+  return pid;
+}
+
+static std::map<std::string, double> loadDurations(const std::string &path) {
+  std::map<std::string, double> durations;
+  FILE *file = path.empty() ? nullptr : fopen(path.c_str(), "r");
+  if (!file)
+    return durations;
+
+  char name[256];
+  double ms;
+  while (fscanf(file, "%255s %lf", name, &ms) == 2)
+    durations[name] = ms;
+  fclose(file);
+  return durations;
+}
+
+static void saveDurations(const std::string &path, const std::map<std::string, double> &durations) {
+  if (path.empty())
+    return;
+
+  // same write-then-rename as the pipeline cache so concurrent runs are safe
+  std::string tempPath = path + ".tmp." + std::to_string(getpid());
+  FILE *file = fopen(tempPath.c_str(), "w");
+  if (!file) {
+    fprintf(stderr, "ERROR opening file '%s'\n", tempPath.c_str());
+    return;
+  }
+  for (const auto &entry : durations)
+    fprintf(file, "%s %.3f\n", entry.first.c_str(), entry.second);
+  if (fclose(file) != 0 || rename(tempPath.c_str(), path.c_str()) != 0) {
+    fprintf(stderr, "ERROR writing durations '%s'\n", path.c_str());
+    remove(tempPath.c_str());
+  }
+}
+
+std::vector<ZooCaseResult> runScheduler(int argc, const char *argv[],
+                                        const std::vector<const ZooCase *> &cases,
+                                        const SchedulerOptions &options) {
+  int workerCount = options.workerCount > 0 ? options.workerCount
+                                            : (int)std::thread::hardware_concurrency();
+  workerCount = std::max(1, std::min(workerCount, (int)cases.size()));
+
+  std::map<std::string, double> durations = loadDurations(options.durationsPath);
+  // cases without history are assumed to be as slow as the slowest known one
+  // so they are dealt out early rather than left to the end
+  double unknownEstimateMs = 1.0;
+  for (const auto &entry : durations)
+    unknownEstimateMs = std::max(unknownEstimateMs, entry.second);
+
+  SharedState state = createSharedState(workerCount, (int)cases.size());
+  for (size_t i = 0; i < cases.size(); i++) {
+    auto known = durations.find(cases[i]->name);
+    state.cases[i].estimateMs = known != durations.end() ? known->second : unknownEstimateMs;
+  }
+  distributeCases(state);
+
+  int64_t timeoutNs = (int64_t)(options.timeoutSeconds * 1e9);
+  auto start = std::chrono::steady_clock::now();
+  int running = 0;
+  for (int i = 0; i < workerCount; i++, running++)
+    spawnWorker(argc, argv, cases, state, i);
+
+  while (running > 0) {
+    int status = 0;
+    pid_t pid = waitpid(-1, &status, WNOHANG);
+    if (pid < 0 && errno != EINTR) {
+      perror("waitpid");
+      abort();
+    }
+
+    if (pid > 0) {
+      int workerIndex = -1;
+      for (int i = 0; i < workerCount; i++) {
+        if (state.workers[i].pid == pid)
+          workerIndex = i;
+      }
+      if (workerIndex < 0)
+        continue;
+
+      WorkerSlot &worker = state.workers[workerIndex];
+      running--;
+      int index = worker.current.exchange(-1);
+      int64_t elapsedNs = nowNs() - worker.caseStartNs.load();
+      if (index >= 0 && worker.timedOutCase >= 0 && elapsedNs <= timeoutNs) {
+        // the kill was meant for a case that finished just before it landed;
+        // the case started since then gets another go
+        requeueCase(state, index);
+        spawnWorker(argc, argv, cases, state, workerIndex);
+        running++;
+      } else if (index >= 0) {
+        // the worker died inside a case; charge it to that case and carry on
+        ZooCaseResult result = {cases[index], ZooCaseStatus::Crashed, 0, 0.0};
+        setZooCaseExitStatus(result, status);
+        if (worker.timedOutCase >= 0)
+          result.status = ZooCaseStatus::TimedOut;
+        result.ms = elapsedNs / 1e6;
+        state.cases[index].status = result.status;
+        state.cases[index].code = result.code;
+        state.cases[index].ms = result.ms;
+        state.cases[index].worker = workerIndex;
+        worker.casesRun++;
+        worker.busyMs += result.ms;
+        printZooCaseResult(result);
+        fflush(stdout);
+
+        if (hasPendingCases(state)) {
+          spawnWorker(argc, argv, cases, state, workerIndex);
+          running++;
+        }
+      } else if (worker.timedOutCase >= 0) {
+        // killed between cases, after the one it was killed for had finished
+        if (hasPendingCases(state)) {
+          spawnWorker(argc, argv, cases, state, workerIndex);
+          running++;
+        }
+      } else if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        // startup failures would repeat on every respawn
+        fprintf(stderr, "worker %d died outside a case, not restarting it\n", workerIndex);
+      }
+      continue;
+    }
+
+    int64_t now = nowNs();
+    for (int i = 0; i < workerCount; i++) {
+      WorkerSlot &worker = state.workers[i];
+      int index = worker.current.load();
+      if (index >= 0 && worker.timedOutCase < 0 && now - worker.caseStartNs.load() > timeoutNs) {
+        worker.timedOutCase = index;
+        kill(worker.pid, SIGKILL);
+      }
+    }
+    usleep(1000);
+  }
+
+  double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  std::vector<ZooCaseResult> results;
+  double caseMs = 0.0;
+  for (size_t i = 0; i < cases.size(); i++) {
+    CaseSlot &slot = state.cases[i];
+    results.push_back({cases[i], slot.status, slot.code, slot.ms});
+    caseMs += slot.ms;
+    if (slot.status == ZooCaseStatus::Passed)
+      durations[cases[i]->name] = slot.ms;
+  }
+  saveDurations(options.durationsPath, durations);
+
+  printf("\n%zu cases on %d workers in %.3f ms (%.3f ms of case time, %.2fx)\n",
+         cases.size(), workerCount, wallMs, caseMs, wallMs > 0.0 ? caseMs / wallMs : 0.0);
+  for (int i = 0; i < workerCount; i++) {
+    WorkerSlot &worker = state.workers[i];
+    printf("  worker %2d: %4d cases, %4d stolen, %10.3f ms busy\n", i, worker.casesRun,
+           worker.casesStolen, worker.busyMs);
+  }
+  for (const ZooCaseResult &result : results)
+    printZooCaseResult(result);
+
+  destroySharedState(state);
+  return results;
+}
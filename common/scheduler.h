@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "common.h"
+#include "zoo_case.h"
+
+// Spreads cases over worker processes, each with its own Context. Cases are
+// dealt out longest-first using the durations recorded by previous runs and
+// idle workers steal from the worker with the most estimated work left. A
+// worker that crashes or times out loses only its current case and is
+// replaced.
+
+struct SchedulerOptions {
+  // 0 uses one worker per hardware thread
+  int workerCount = 0;
+  double timeoutSeconds = 60.0;
+  // per-case durations read before and written after the run, empty disables
+  std::string durationsPath = "vk_parameter_zoo.durations";
+};
+
+std::vector<ZooCaseResult> runScheduler(int argc, const char *argv[],
+                                        const std::vector<const ZooCase *> &cases,
+                                        const SchedulerOptions &options);
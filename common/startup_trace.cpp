@@ -0,0 +1,64 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include "startup_trace.h"
+
+static double nowUs() {
+  return std::chrono::duration<double, std::micro>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+StartupPhaseScope::StartupPhaseScope(std::vector<StartupPhase> &phases, const char *name)
+    : phases(phases), phase{name, nowUs(), 0.0} {}
+
+StartupPhaseScope::~StartupPhaseScope() {
+  phase.durationUs = nowUs() - phase.startUs;
+  phases.push_back(phase);
+}
+
+void printStartupSummary(const std::vector<StartupPhase> &phases) {
+  if (phases.empty())
+    return;
+
+  double startUs = phases.front().startUs;
+  double endUs = startUs;
+  for (const StartupPhase &phase : phases)
+    endUs = std::max(endUs, phase.startUs + phase.durationUs);
+
+  printf("startup %.3f ms:", (endUs - startUs) / 1000.0);
+  for (const StartupPhase &phase : phases)
+    printf(" %s %.3f", phase.name, phase.durationUs / 1000.0);
+  printf("\n");
+}
+
+void writeStartupTrace(const std::vector<StartupPhase> &phases, const std::string &path) {
+  if (path.empty())
+    return;
+
+  std::string resolved = path;
+  size_t pidPos = resolved.find("%p");
+  if (pidPos != std::string::npos)
+    resolved.replace(pidPos, 2, std::to_string(getpid()));
+
+  FILE *file = fopen(resolved.c_str(), "w");
+  if (!file) {
+    fprintf(stderr, "ERROR opening file '%s'\n", resolved.c_str());
+    return;
+  }
+
+  int pid = (int)getpid();
+  fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+  for (size_t i = 0; i < phases.size(); i++) {
+    const StartupPhase &phase = phases[i];
+    fprintf(file,
+            "{\"name\":\"%s\",\"cat\":\"startup\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+            "\"pid\":%d,\"tid\":%d}%s\n",
+            phase.name, phase.startUs, phase.durationUs, pid, pid,
+            i + 1 < phases.size() ? "," : "");
+  }
+  fprintf(file, "]}\n");
+  if (fclose(file) != 0)
+    fprintf(stderr, "ERROR writing startup trace '%s'\n", resolved.c_str());
+}
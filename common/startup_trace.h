@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Wall-clock timing of the phases of ensureContext, reported as a one
+// line summary and optionally as Chrome trace-event JSON (chrome://tracing,
+// Perfetto).
+
+struct StartupPhase {
+  const char *name;
+  // steady clock, microseconds
+  double startUs;
+  double durationUs;
+};
+
+// records the lifetime of the scope as one phase
+struct StartupPhaseScope {
+  StartupPhaseScope(std::vector<StartupPhase> &phases, const char *name);
+  ~StartupPhaseScope();
+
+  std::vector<StartupPhase> &phases;
+  StartupPhase phase;
+};
+
+void printStartupSummary(const std::vector<StartupPhase> &phases);
+// "%p" in the path is replaced by the process id so forked workers keep
+// their own trace
+void writeStartupTrace(const std::vector<StartupPhase> &phases, const std::string &path);
@@ -0,0 +1,160 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include "validation_log.h"
+
+static std::atomic<uint64_t> nextValidationLogId{1};
+
+struct ThreadRing {
+  uint64_t logId = 0;
+  ValidationRing *ring = nullptr;
+};
+
+static thread_local ThreadRing threadRing;
+
+static ValidationRing *getThreadRing(ValidationLog *log) {
+  if (threadRing.logId == log->id)
+    return threadRing.ring;
+
+  // the cache holds one log, so a thread alternating between logs comes back
+  // here and must find the ring it registered before
+  std::thread::id self = std::this_thread::get_id();
+  ValidationRing *ring = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(log->ringsMutex);
+    for (ValidationRing *existing : log->rings) {
+      if (existing->owner == self) {
+        ring = existing;
+        break;
+      }
+    }
+    if (!ring) {
+      ring = new ValidationRing();
+      ring->owner = self;
+      log->rings.push_back(ring);
+    }
+  }
+  threadRing.logId = log->id;
+  threadRing.ring = ring;
+  return ring;
+}
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL
+validationCallback(VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+                   VkDebugUtilsMessageTypeFlagsEXT types,
+                   const VkDebugUtilsMessengerCallbackDataEXT *callbackData,
+                   void *userData) {
+  (void)types;
+  ValidationLog *log = (ValidationLog *)userData;
+  ValidationRing *ring = getThreadRing(log);
+
+  uint32_t head = ring->head.load(std::memory_order_relaxed);
+  if (head - ring->tail.load(std::memory_order_acquire) >= ValidationRingSize) {
+    log->dropped.fetch_add(1, std::memory_order_relaxed);
+    return VK_FALSE;
+  }
+
+  ValidationRecord &record = ring->records[head % ValidationRingSize];
+  record.messageIdNumber = callbackData->messageIdNumber;
+  record.severity = severity;
+  snprintf(record.messageIdName, sizeof(record.messageIdName), "%s",
+           callbackData->pMessageIdName ? callbackData->pMessageIdName : "");
+  snprintf(record.message, sizeof(record.message), "%s",
+           callbackData->pMessage ? callbackData->pMessage : "");
+  ring->head.store(head + 1, std::memory_order_release);
+  return VK_FALSE;
+}
+
+ValidationLog *createValidationLog() {
+  ValidationLog *log = new ValidationLog();
+  log->id = nextValidationLogId.fetch_add(1);
+  return log;
+}
+
+void destroyValidationLog(ValidationLog *log) {
+  if (!log)
+    return;
+  // threads caching a ring compare ids, so the stale pointer is never used
+  for (ValidationRing *ring : log->rings)
+    delete ring;
+  delete log;
+}
+
+VkDebugUtilsMessengerCreateInfoEXT getValidationMessengerCreateInfo(ValidationLog *log) {
+  VkDebugUtilsMessengerCreateInfoEXT createInfo = {};
+  createInfo.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
+  createInfo.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT |
+                               VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+  createInfo.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT |
+                           VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT |
+                           VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+  createInfo.pfnUserCallback = validationCallback;
+  createInfo.pUserData = log;
+  return createInfo;
+}
+
+ValidationSummary takeValidationSummary(ValidationLog *log) {
+  ValidationSummary summary;
+  if (!log)
+    return summary;
+
+  std::map<std::string, ValidationMessageCount> byVuid;
+  {
+    std::lock_guard<std::mutex> lock(log->ringsMutex);
+    for (ValidationRing *ring : log->rings) {
+      uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+      uint32_t head = ring->head.load(std::memory_order_acquire);
+      for (; tail != head; tail++) {
+        const ValidationRecord &record = ring->records[tail % ValidationRingSize];
+        std::string vuid = record.messageIdName;
+        if (vuid.empty()) {
+          char id[16];
+          snprintf(id, sizeof(id), "0x%08x", (uint32_t)record.messageIdNumber);
+          vuid = id;
+        }
+
+        ValidationMessageCount &entry = byVuid[vuid];
+        if (entry.count++ == 0) {
+          entry.vuid = vuid;
+          entry.severity = record.severity;
+          entry.message = record.message;
+        }
+        summary.total++;
+      }
+      ring->tail.store(tail, std::memory_order_release);
+    }
+  }
+  summary.dropped = log->dropped.exchange(0);
+
+  for (auto &entry : byVuid)
+    summary.messages.push_back(std::move(entry.second));
+  std::stable_sort(summary.messages.begin(), summary.messages.end(),
+                   [](const ValidationMessageCount &a, const ValidationMessageCount &b) {
+                     return a.count > b.count;
+                   });
+  return summary;
+}
+
+uint64_t countValidationMessages(const ValidationSummary &summary, const char *vuid) {
+  for (const ValidationMessageCount &entry : summary.messages) {
+    if (entry.vuid == vuid)
+      return entry.count;
+  }
+  return 0;
+}
+
+void printValidationSummary(const ValidationSummary &summary) {
+  if (summary.total == 0 && summary.dropped == 0)
+    return;
+
+  printf("validation: %" PRIu64 " messages, %zu unique, %" PRIu64 " dropped\n", summary.total,
+         summary.messages.size(), summary.dropped);
+  for (const ValidationMessageCount &entry : summary.messages) {
+    const char *severity =
+        entry.severity >= VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT ? "error" : "warning";
+    printf("  %6" PRIu64 "x %s (%s): %.160s\n", entry.count, entry.vuid.c_str(), severity,
+           entry.message.c_str());
+  }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "volk/volk.h"
+
+// Captures VK_EXT_debug_utils messages without serializing the threads that
+// trigger them. The callback appends to a single-producer ring owned by the
+// calling thread; takeValidationSummary drains every ring and folds the
+// messages by VUID.
+
+static const uint32_t ValidationRingSize = 1024;
+
+struct ValidationRecord {
+  int32_t messageIdNumber;
+  VkDebugUtilsMessageSeverityFlagBitsEXT severity;
+  char messageIdName[96];
+  char message[416];
+};
+
+struct ValidationRing {
+  std::thread::id owner;
+  // written only by the owning thread
+  std::atomic<uint32_t> head{0};
+  // written only by the drain
+  std::atomic<uint32_t> tail{0};
+  ValidationRecord records[ValidationRingSize];
+};
+
+struct ValidationLog {
+  // never reused, lets threads cache their ring without a lookup
+  uint64_t id;
+  // taken when a thread misses its cached ring, and by the drain
+  std::mutex ringsMutex;
+  std::vector<ValidationRing *> rings;
+  // messages lost because a ring was full
+  std::atomic<uint64_t> dropped{0};
+};
+
+struct ValidationMessageCount {
+  // pMessageIdName, or the hex messageIdNumber when the layer gives no name
+  std::string vuid;
+  VkDebugUtilsMessageSeverityFlagBitsEXT severity;
+  uint64_t count;
+  // text of the first occurrence
+  std::string message;
+};
+
+struct ValidationSummary {
+  // sorted by descending count
+  std::vector<ValidationMessageCount> messages;
+  uint64_t total = 0;
+  uint64_t dropped = 0;
+};
+
+ValidationLog *createValidationLog();
+void destroyValidationLog(ValidationLog *log);
+// for VkInstanceCreateInfo::pNext and vkCreateDebugUtilsMessengerEXT
+VkDebugUtilsMessengerCreateInfoEXT getValidationMessengerCreateInfo(ValidationLog *log);
+
+// everything logged since the last call; empty when log is null
+ValidationSummary takeValidationSummary(ValidationLog *log);
+// occurrences of one VUID, for cases that expect or forbid a message
+uint64_t countValidationMessages(const ValidationSummary &summary, const char *vuid);
+void printValidationSummary(const ValidationSummary &summary);
@@ -0,0 +1,76 @@
+#include <fnmatch.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include "zoo_case.h"
+
+// function-local so registration from other translation units' static
+// initializers never sees an unconstructed vector
+static std::vector<ZooCase> &zooCases() {
+  static std::vector<ZooCase> cases;
+  return cases;
+}
+
+ZooCaseRegistrar::ZooCaseRegistrar(const char *name, ZooCaseFunction function,
+                                   uint32_t requirements) {
+  zooCases().push_back({name, function, requirements});
+}
+
+const std::vector<ZooCase> &getZooCases() {
+  std::vector<ZooCase> &cases = zooCases();
+  // registration order depends on link order, keep runs reproducible
+  std::sort(cases.begin(), cases.end(), [](const ZooCase &a, const ZooCase &b) {
+    return strcmp(a.name, b.name) < 0;
+  });
+  return cases;
+}
+
+std::vector<const ZooCase *> findZooCases(const char *filter) {
+  std::vector<const ZooCase *> matches;
+  for (const ZooCase &zooCase : getZooCases()) {
+    if (fnmatch(filter, zooCase.name, 0) == 0)
+      matches.push_back(&zooCase);
+  }
+  return matches;
+}
+
+uint32_t getZooCaseRequirements(const std::vector<const ZooCase *> &cases) {
+  uint32_t requirements = 0;
+  for (const ZooCase *zooCase : cases)
+    requirements |= zooCase->requirements;
+  return requirements;
+}
+
+void runZooCase(Context &context, const ZooCase *zooCase) {
+  ensureContext(context, zooCase->requirements);
+  resetContext(context);
+
+  HostAllocatorStats before = getHostAllocatorStats(context.hostAllocator);
+  zooCase->function(context);
+
+  printValidationSummary(takeValidationSummary(context.validationLog));
+  if (context.hostAllocator)
+    printHostAllocatorStats(
+        diffHostAllocatorStats(before, getHostAllocatorStats(context.hostAllocator)), zooCase->name);
+}
+
+void printZooCaseResult(const ZooCaseResult &result) {
+  const char *name = result.zooCase->name;
+  switch (result.status) {
+  case ZooCaseStatus::Passed:
+    printf("[ DONE ] %s (%.3f ms)\n", name, result.ms);
+    break;
+  case ZooCaseStatus::Failed:
+    printf("[ FAIL ] %s exited with %d (%.3f ms)\n", name, result.code, result.ms);
+    break;
+  case ZooCaseStatus::Crashed:
+    printf("[CRASH ] %s %s (%.3f ms)\n", name, strsignal(result.code), result.ms);
+    break;
+  case ZooCaseStatus::TimedOut:
+    printf("[ TIME ] %s killed after %.3f ms\n", name, result.ms);
+    break;
+  case ZooCaseStatus::NotRun:
+    printf("[ SKIP ] %s not run\n", name);
+    break;
+  }
+}
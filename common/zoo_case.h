@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+#include "common.h"
+
+// In-process registry of zoo cases. Every case runs against a shared Context;
+// resetContext restores the base pipeline state in between, anything else a
+// case creates it must destroy itself. Each case declares the
+// ContextRequirement bits it uses and the runner creates only those.
+
+typedef void (*ZooCaseFunction)(Context &context);
+
+struct ZooCase {
+  const char *name;
+  ZooCaseFunction function;
+  uint32_t requirements;
+};
+
+struct ZooCaseRegistrar {
+  ZooCaseRegistrar(const char *name, ZooCaseFunction function, uint32_t requirements);
+};
+
+enum class ZooCaseStatus {
+  Passed,
+  // exited with a non-zero status
+  Failed,
+  // killed by a signal, usually the driver tripping over a poisoned parameter
+  Crashed,
+  TimedOut,
+  // never started, e.g. every worker died during startup
+  NotRun,
+};
+
+struct ZooCaseResult {
+  const ZooCase *zooCase;
+  ZooCaseStatus status;
+  // exit status for Failed, signal number for Crashed
+  int code;
+  double ms;
+};
+
+const std::vector<ZooCase> &getZooCases();
+// glob match on the case name, e.g. "bug*"
+std::vector<const ZooCase *> findZooCases(const char *filter);
+// union of the requirements, for setting up the instance before any case runs
+uint32_t getZooCaseRequirements(const std::vector<const ZooCase *> &cases);
+void printZooCaseResult(const ZooCaseResult &result);
+// creates what the case requires, resets the base pipeline state, runs it and
+// prints what it did to the validation log and the host allocator
+void runZooCase(Context &context, const ZooCase *zooCase);
+
+#define ZOO_CASE(name, requirements)                                           \
+  static void zooCase_##name(Context &context);                                \
+  static ZooCaseRegistrar zooCaseRegistrar_##name(#name, zooCase_##name,       \
+                                                  requirements);               \
+  static void zooCase_##name(Context &context)
+
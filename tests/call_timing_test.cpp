@@ -0,0 +1,49 @@
+#include <math.h>
+#include <stdint.h>
+#include <initializer_list>
+#include "common/call_timing.h"
+#include "unit_test.h"
+
+// everything past 2^40 ticks saturates into the last bucket
+static uint32_t lastHistogramBucket() {
+  return histogramBucket(UINT64_MAX);
+}
+
+UNIT_TEST(histogram_small_values_are_exact) {
+  for (uint64_t ticks = 0; ticks < 16; ticks++) {
+    CHECK(histogramBucket(ticks) == ticks);
+    CHECK(histogramBucketValue((uint32_t)ticks) == (double)ticks);
+  }
+}
+
+UNIT_TEST(histogram_buckets_round_trip) {
+  uint32_t last = lastHistogramBucket();
+  CHECK(last == 607);
+  for (uint32_t bucket = 0; bucket <= last; bucket++)
+    CHECK(histogramBucket((uint64_t)histogramBucketValue(bucket)) == bucket);
+}
+
+UNIT_TEST(histogram_buckets_are_monotonic) {
+  uint32_t previous = 0;
+  for (uint64_t ticks = 0; ticks < (1 << 16); ticks++) {
+    uint32_t bucket = histogramBucket(ticks);
+    CHECK(bucket == previous || bucket == previous + 1);
+    previous = bucket;
+  }
+}
+
+UNIT_TEST(histogram_values_are_within_a_sixteenth) {
+  uint32_t last = lastHistogramBucket();
+  for (uint32_t exponent = 4; exponent <= 40; exponent++) {
+    uint64_t power = 1ull << exponent;
+    for (uint64_t ticks : {power - 1, power, power + 1, power + power / 3, power * 2 - 1}) {
+      uint32_t bucket = histogramBucket(ticks);
+      CHECK(bucket <= last);
+      CHECK(fabs(histogramBucketValue(bucket) - (double)ticks) <= ticks / 32.0 + 0.5);
+    }
+  }
+
+  CHECK(histogramBucket((1ull << 41) - 1) == last);
+  CHECK(histogramBucket(1ull << 41) == last);
+  CHECK(histogramBucket(1ull << 63) == last);
+}
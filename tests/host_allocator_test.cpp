@@ -0,0 +1,118 @@
+#include <stdint.h>
+#include <string.h>
+#include <future>
+#include <thread>
+#include <vector>
+#include "common/host_allocator.h"
+#include "unit_test.h"
+
+static void *allocateObject(HostAllocator *allocator, size_t size, size_t alignment = 16) {
+  return allocator->callbacks.pfnAllocation(allocator, size, alignment,
+                                            VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+}
+
+static void freeObject(HostAllocator *allocator, void *memory) {
+  allocator->callbacks.pfnFree(allocator, memory);
+}
+
+static HostAllocationScopeStats objectStats(const HostAllocatorStats &stats) {
+  return stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_OBJECT];
+}
+
+UNIT_TEST(host_arena_rewinds_once_empty) {
+  HostAllocator *allocator = createHostAllocator(true);
+  char *first = (char *)allocateObject(allocator, 100);
+  char *second = (char *)allocateObject(allocator, 100);
+  CHECK(second >= first + 100);
+
+  // the block still holds second, so it keeps bumping
+  freeObject(allocator, first);
+  char *third = (char *)allocateObject(allocator, 100);
+  CHECK(third >= second + 100);
+
+  freeObject(allocator, second);
+  freeObject(allocator, third);
+  char *rewound = (char *)allocateObject(allocator, 100);
+  CHECK(rewound == first);
+  freeObject(allocator, rewound);
+
+  HostAllocationScopeStats stats = objectStats(getHostAllocatorStats(allocator));
+  CHECK(stats.allocations == 4);
+  CHECK(stats.arenaAllocations == 4);
+  CHECK(stats.frees == 4);
+  CHECK(stats.liveBytes == 0);
+  CHECK(stats.peakBytes == 200);
+  delete allocator;
+}
+
+UNIT_TEST(host_arena_rewinds_after_remote_free) {
+  HostAllocator *allocator = createHostAllocator(true);
+  void *first = nullptr;
+  void *again = nullptr;
+  std::promise<void> allocated;
+  std::promise<void> freed;
+  std::thread owner([&] {
+    first = allocateObject(allocator, 100);
+    allocated.set_value();
+    freed.get_future().wait();
+    again = allocateObject(allocator, 100);
+    freeObject(allocator, again);
+  });
+
+  allocated.get_future().wait();
+  freeObject(allocator, first);
+  freed.set_value();
+  owner.join();
+
+  CHECK(again == first);
+  CHECK(objectStats(getHostAllocatorStats(allocator)).liveBytes == 0);
+  delete allocator;
+}
+
+UNIT_TEST(host_arena_outlives_its_thread) {
+  HostAllocator *allocator = createHostAllocator(true);
+  allocator->arenaBlockSize = 64 << 10;
+
+  // enough to fill several blocks, all still live when the thread exits
+  std::vector<void *> memory;
+  std::thread producer([&] {
+    for (uint32_t i = 0; i < 256; i++)
+      memory.push_back(allocateObject(allocator, 1000));
+  });
+  producer.join();
+
+  for (void *allocation : memory) {
+    CHECK(allocation);
+    // the blocks are released by these frees, so they must still be readable
+    memset(allocation, 0xcd, 1000);
+    freeObject(allocator, allocation);
+  }
+
+  HostAllocationScopeStats stats = objectStats(getHostAllocatorStats(allocator));
+  CHECK(stats.arenaAllocations == 256);
+  CHECK(stats.frees == 256);
+  CHECK(stats.liveBytes == 0);
+  delete allocator;
+}
+
+UNIT_TEST(host_arena_falls_back_to_heap) {
+  HostAllocator *allocator = createHostAllocator(true);
+
+  void *large = allocateObject(allocator, allocator->arenaBlockSize * 2);
+  void *aligned = allocateObject(allocator, 100, 256);
+  void *device = allocator->callbacks.pfnAllocation(allocator, 100, 16,
+                                                    VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+  CHECK(large && aligned && device);
+  CHECK(((uintptr_t)aligned & 255) == 0);
+
+  HostAllocatorStats stats = getHostAllocatorStats(allocator);
+  CHECK(objectStats(stats).allocations == 2);
+  CHECK(objectStats(stats).arenaAllocations == 0);
+  CHECK(stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_DEVICE].arenaAllocations == 0);
+
+  freeObject(allocator, large);
+  freeObject(allocator, aligned);
+  freeObject(allocator, device);
+  CHECK(objectStats(getHostAllocatorStats(allocator)).liveBytes == 0);
+  delete allocator;
+}
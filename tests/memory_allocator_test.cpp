@@ -0,0 +1,138 @@
+#include <stdint.h>
+#include <iterator>
+#include "common/memory_allocator.h"
+#include "unit_test.h"
+
+// VkDeviceMemory is only ever a handle to the allocator, so the fake device
+// hands out counters and keeps track of how many are live
+static uint64_t fakeMemoryCount = 0;
+static uint64_t liveFakeMemory = 0;
+
+static void VKAPI_CALL fakeGetPhysicalDeviceProperties(VkPhysicalDevice, VkPhysicalDeviceProperties *properties) {
+  *properties = VkPhysicalDeviceProperties();
+  properties->limits.bufferImageGranularity = 1;
+}
+
+static VkResult VKAPI_CALL fakeAllocateMemory(VkDevice, const VkMemoryAllocateInfo *, const VkAllocationCallbacks *,
+                                              VkDeviceMemory *memory) {
+  *memory = (VkDeviceMemory)(uintptr_t)++fakeMemoryCount;
+  liveFakeMemory++;
+  return VK_SUCCESS;
+}
+
+static void VKAPI_CALL fakeFreeMemory(VkDevice, VkDeviceMemory, const VkAllocationCallbacks *) {
+  liveFakeMemory--;
+}
+
+// one DEVICE_LOCAL memory type; 4 KiB blocks give orders 0 (256 bytes) to 4
+static void createFakeAllocator(Context &context, MemoryAllocator &allocator) {
+  vkGetPhysicalDeviceProperties = fakeGetPhysicalDeviceProperties;
+  context.deviceTable.vkAllocateMemory = fakeAllocateMemory;
+  context.deviceTable.vkFreeMemory = fakeFreeMemory;
+
+  context.memoryProperties = VkPhysicalDeviceMemoryProperties();
+  context.memoryProperties.memoryTypeCount = 1;
+  context.memoryProperties.memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+  for (uint32_t flags = 0; flags < std::size(context.memoryTypeBitsByFlags); ++flags)
+    context.memoryTypeBitsByFlags[flags] = (flags & ~VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) == 0 ? 1u : 0u;
+
+  createMemoryAllocator(context, allocator, 4096);
+  CHECK(allocator.minNodeSize == 256);
+  CHECK(allocator.maxOrder == 4);
+}
+
+static void allocateFake(MemoryAllocator &allocator, VkDeviceSize size, VkDeviceSize alignment,
+                         MemoryAllocation &allocation) {
+  VkMemoryRequirements requirements = {};
+  requirements.size = size;
+  requirements.alignment = alignment;
+  requirements.memoryTypeBits = 1;
+  allocateMemory(allocator, requirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, allocation);
+}
+
+UNIT_TEST(buddy_splits_and_merges) {
+  const char *argv[] = {"zoo_unit_tests"};
+  Context context(1, argv);
+  MemoryAllocator allocator;
+  createFakeAllocator(context, allocator);
+
+  // splitting 4096 for 256 leaves one free buddy at each order, so the next
+  // requests are served from them without another block
+  MemoryAllocation allocations[4];
+  allocateFake(allocator, 200, 16, allocations[0]);
+  CHECK(allocations[0].offset == 0 && allocations[0].order == 0);
+  MemoryAllocatorStats stats = getMemoryAllocatorStats(allocator);
+  CHECK(stats.freeBytes == 4096 - 256);
+  CHECK(stats.largestFreeRange == 2048);
+
+  allocateFake(allocator, 256, 16, allocations[1]);
+  allocateFake(allocator, 1000, 16, allocations[2]);
+  allocateFake(allocator, 512, 16, allocations[3]);
+  CHECK(allocations[1].offset == 256);
+  CHECK(allocations[2].offset == 1024 && allocations[2].order == 2);
+  CHECK(allocations[3].offset == 512 && allocations[3].order == 1);
+
+  stats = getMemoryAllocatorStats(allocator);
+  CHECK(stats.blockCount == 1);
+  CHECK(stats.allocationCount == 4);
+  CHECK(stats.requestedBytes == 200 + 256 + 1000 + 512);
+  CHECK(stats.reservedBytes == 2048);
+  CHECK(stats.largestFreeRange == 2048);
+
+  // freeing out of order still merges every buddy back into one node
+  freeMemory(allocator, allocations[1]);
+  freeMemory(allocator, allocations[3]);
+  stats = getMemoryAllocatorStats(allocator);
+  CHECK(stats.largestFreeRange == 2048);
+  CHECK(stats.freeBytes == 4096 - 256 - 1024);
+  freeMemory(allocator, allocations[0]);
+  freeMemory(allocator, allocations[2]);
+  stats = getMemoryAllocatorStats(allocator);
+  CHECK(stats.freeBytes == 4096);
+  CHECK(stats.largestFreeRange == 4096);
+  CHECK(stats.externalFragmentation == 0.0);
+
+  MemoryAllocation whole;
+  allocateFake(allocator, 4096, 16, whole);
+  CHECK(whole.offset == 0 && whole.order == 4 && !whole.dedicated);
+  CHECK(getMemoryAllocatorStats(allocator).blockCount == 1);
+  freeMemory(allocator, whole);
+
+  destroyMemoryAllocator(allocator);
+  CHECK(liveFakeMemory == 0);
+}
+
+UNIT_TEST(buddy_aligns_and_spills) {
+  const char *argv[] = {"zoo_unit_tests"};
+  Context context(1, argv);
+  MemoryAllocator allocator;
+  createFakeAllocator(context, allocator);
+
+  // the alignment, not the size, picks the node
+  MemoryAllocation small, aligned;
+  allocateFake(allocator, 16, 16, small);
+  allocateFake(allocator, 16, 1024, aligned);
+  CHECK(aligned.order == 2);
+  CHECK(aligned.offset % 1024 == 0);
+
+  // a full block's worth needs a second block, anything larger a dedicated one
+  MemoryAllocation full, dedicated;
+  allocateFake(allocator, 4096, 16, full);
+  CHECK(full.blockIndex == 1 && full.offset == 0);
+  allocateFake(allocator, 4097, 16, dedicated);
+  CHECK(dedicated.dedicated);
+  CHECK(liveFakeMemory == 3);
+
+  MemoryAllocatorStats stats = getMemoryAllocatorStats(allocator);
+  CHECK(stats.blockCount == 2);
+  CHECK(stats.dedicatedAllocationCount == 1);
+  CHECK(stats.deviceBytes == 2 * 4096 + 4097);
+
+  freeMemory(allocator, small);
+  freeMemory(allocator, aligned);
+  freeMemory(allocator, full);
+  freeMemory(allocator, dedicated);
+  CHECK(liveFakeMemory == 2);
+  destroyMemoryAllocator(allocator);
+  CHECK(liveFakeMemory == 0);
+}
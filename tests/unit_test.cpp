@@ -0,0 +1,48 @@
+#include <fnmatch.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "unit_test.h"
+
+struct UnitTest {
+  const char *name;
+  UnitTestFunction function;
+};
+
+// function-local for the same reason as the zoo case registry
+static std::vector<UnitTest> &unitTests() {
+  static std::vector<UnitTest> tests;
+  return tests;
+}
+
+UnitTestRegistrar::UnitTestRegistrar(const char *name, UnitTestFunction function) {
+  unitTests().push_back({name, function});
+}
+
+int main(int argc, const char *argv[]) {
+  const char *filter = argc > 1 ? argv[1] : "*";
+
+  std::vector<UnitTest> &tests = unitTests();
+  std::sort(tests.begin(), tests.end(), [](const UnitTest &a, const UnitTest &b) {
+    return strcmp(a.name, b.name) < 0;
+  });
+
+  uint32_t run = 0;
+  for (const UnitTest &test : tests) {
+    if (fnmatch(filter, test.name, 0) != 0)
+      continue;
+    printf("[ RUN  ] %s\n", test.name);
+    fflush(stdout);
+    test.function();
+    printf("[  OK  ] %s\n", test.name);
+    run++;
+  }
+
+  if (run == 0) {
+    fprintf(stderr, "ERROR no unit test matches '%s'\n", filter);
+    return 1;
+  }
+  printf("%u unit tests passed\n", run);
+  return 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Host-only checks of the pieces that don't need a Vulkan driver. Each
+// UNIT_TEST registers itself; zoo_unit_tests runs them all, or those matching
+// a glob given as its only argument. A failing CHECK aborts the run.
+
+typedef void (*UnitTestFunction)();
+
+struct UnitTestRegistrar {
+  UnitTestRegistrar(const char *name, UnitTestFunction function);
+};
+
+#define UNIT_TEST(name)                                                        \
+  static void unitTest_##name();                                               \
+  static UnitTestRegistrar unitTestRegistrar_##name(#name, unitTest_##name);   \
+  static void unitTest_##name()
+
+#define CHECK(condition)                                                       \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__,         \
+              #condition);                                                     \
+      abort();                                                                 \
+    }                                                                          \
+  } while (0)
@@ -1,19 +1,16 @@
 #include "common/common.h"
+#include "common/guard_pages.h"
+#include "common/zoo_case.h"
 
-int main(int argc, const char * argv[])
+ZOO_CASE(bug1, RequirePipeline)
 {
-  Context context;
-  initializeContext(context, "vk_parameter_zoo_bug_1");
-
   /*
    pTessellationState is ignored if the pipeline does not include a tessellation control shader stage and tessellation evaluation shader stage.
    */
-  context.basePipelineCreateInfo.pTessellationState = (VkPipelineTessellationStateCreateInfo *)0x1234;
+  context.basePipelineCreateInfo.pTessellationState = (VkPipelineTessellationStateCreateInfo *)poisonPointer(context, "pTessellationState");
   createPipeline(context);
   destroyPipeline(context);
+  reportGuardPageHits(context, "Bug1");
 
-  printf("Bug1 pTessellationState = 0x1234\n");
-
-  destroyContext(context);
-  return 1;
+  printf("Bug1 pTessellationState = %p\n", (const void *)context.basePipelineCreateInfo.pTessellationState);
 }
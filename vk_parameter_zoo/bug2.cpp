@@ -1,23 +1,24 @@
 #include "common/common.h"
+#include "common/guard_pages.h"
+#include "common/zoo_case.h"
 
-int main(int argc, const char * argv[])
+ZOO_CASE(bug2, RequirePipeline)
 {
-  Context context;
-  initializeContext(context, "vk_parameter_zoo");
-
   /*
    when rasterization is disabled, a lot of state should be ignored
    */
   context.rasterStateCreateInfo.rasterizerDiscardEnable = VK_TRUE;
-  context.basePipelineCreateInfo.pViewportState = (VkPipelineViewportStateCreateInfo*)0x1234;
-  context.basePipelineCreateInfo.pMultisampleState = (VkPipelineMultisampleStateCreateInfo*)0x1234;
-  context.basePipelineCreateInfo.pDepthStencilState = (VkPipelineDepthStencilStateCreateInfo*)0x1234;
-  context.basePipelineCreateInfo.pColorBlendState = (VkPipelineColorBlendStateCreateInfo*)0x1234;
+  context.basePipelineCreateInfo.pViewportState = (VkPipelineViewportStateCreateInfo*)poisonPointer(context, "pViewportState");
+  context.basePipelineCreateInfo.pMultisampleState = (VkPipelineMultisampleStateCreateInfo*)poisonPointer(context, "pMultisampleState");
+  context.basePipelineCreateInfo.pDepthStencilState = (VkPipelineDepthStencilStateCreateInfo*)poisonPointer(context, "pDepthStencilState");
+  context.basePipelineCreateInfo.pColorBlendState = (VkPipelineColorBlendStateCreateInfo*)poisonPointer(context, "pColorBlendState");
   createPipeline(context);
   destroyPipeline(context);
+  reportGuardPageHits(context, "Bug2");
 
-  printf("Bug2: rasterizerDiscardEnable TRUE set various rasterisation pointers to 0x1234\n");
-
-  destroyContext(context);
-  return 1;
+  const VkGraphicsPipelineCreateInfo &createInfo = context.basePipelineCreateInfo;
+  printf("Bug2: rasterizerDiscardEnable TRUE set pViewportState = %p, pMultisampleState = %p, "
+         "pDepthStencilState = %p, pColorBlendState = %p\n",
+         (const void *)createInfo.pViewportState, (const void *)createInfo.pMultisampleState,
+         (const void *)createInfo.pDepthStencilState, (const void *)createInfo.pColorBlendState);
 }
@@ -1,12 +1,11 @@
 #include <algorithm>
 
 #include "common/common.h"
+#include "common/memory_allocator.h"
+#include "common/zoo_case.h"
 
-int main(int argc, const char * argv[])
+ZOO_CASE(bug3, RequireDevice)
 {
-  Context context(argc, argv);
-  initializeContext(context, "vk_parameter_zoo");
-
   /*
    updates to a VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER descriptor with immutable samplers does not modify the samplers (the image views are updated, but the sampler updates are ignored).
    
@@ -39,7 +38,7 @@ int main(int argc, const char * argv[])
   samplerCreateInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
   samplerCreateInfo.pNext = nullptr;
   samplerCreateInfo.unnormalizedCoordinates = VK_FALSE;
-  VULKAN_CHECK(vkCreateSampler(context.device, &samplerCreateInfo, NULL, &validSampler));
+  VULKAN_CHECK(context.deviceTable.vkCreateSampler(context.device, &samplerCreateInfo, context.allocationCallbacks, &validSampler));
   VkSampler invalidSampler = (VkSampler)0x1234;
 
   VkDescriptorSetLayoutBinding descriptorSetLayoutBindings[2];
@@ -65,7 +64,7 @@ int main(int argc, const char * argv[])
   layoutInfo.pBindings = descriptorSetLayoutBindings;
   layoutInfo.pNext = nullptr;
 
-  VULKAN_CHECK(vkCreateDescriptorSetLayout(context.device, &layoutInfo, nullptr, &descriptorSetLayout));
+  VULKAN_CHECK(context.deviceTable.vkCreateDescriptorSetLayout(context.device, &layoutInfo, context.allocationCallbacks, &descriptorSetLayout));
 
   VkDescriptorPoolSize poolSizes[] =
   {
@@ -91,7 +90,7 @@ int main(int argc, const char * argv[])
   descPoolCreateInfo.poolSizeCount = std::size(poolSizes);
 
   VkDescriptorPool descriptorPool;
-  VULKAN_CHECK(vkCreateDescriptorPool(context.device, &descPoolCreateInfo, nullptr, &descriptorPool));
+  VULKAN_CHECK(context.deviceTable.vkCreateDescriptorPool(context.device, &descPoolCreateInfo, context.allocationCallbacks, &descriptorPool));
   
   VkDescriptorSetAllocateInfo descSetAllocateInfo;
   descSetAllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
@@ -121,21 +120,20 @@ int main(int argc, const char * argv[])
   VK_IMAGE_USAGE_TRANSFER_DST_BIT;
 
   VkImage validImage;
-  VULKAN_CHECK(vkCreateImage(context.device, &imageCreateInfo, nullptr, &validImage));
+  VULKAN_CHECK(context.deviceTable.vkCreateImage(context.device, &imageCreateInfo, context.allocationCallbacks, &validImage));
   
   VkMemoryRequirements memoryRequirements;
-  vkGetImageMemoryRequirements(context.device, validImage, &memoryRequirements);
+  context.deviceTable.vkGetImageMemoryRequirements(context.device, validImage, &memoryRequirements);
 
-  VkMemoryAllocateInfo allocateInfo;
-  allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-  allocateInfo.allocationSize = memoryRequirements.size;
-  allocateInfo.memoryTypeIndex = getMemoryTypeIndex(context, memoryRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-  allocateInfo.pNext = nullptr;
+  // one small image, so one block just big enough for it rather than the
+  // default 64 MiB
+  MemoryAllocator allocator;
+  createMemoryAllocator(context, allocator, std::max(memoryRequirements.size, memoryRequirements.alignment));
 
-  VkDeviceMemory imageMemory;
-  VULKAN_CHECK(vkAllocateMemory(context.device, &allocateInfo, nullptr, &imageMemory));
+  MemoryAllocation imageMemory;
+  allocateMemory(allocator, memoryRequirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, imageMemory);
 
-  VULKAN_CHECK(vkBindImageMemory(context.device, validImage, imageMemory, 0));
+  VULKAN_CHECK(context.deviceTable.vkBindImageMemory(context.device, validImage, imageMemory.memory, imageMemory.offset));
 
   VkComponentMapping components;
   components.a = VK_COMPONENT_SWIZZLE_IDENTITY;
@@ -161,10 +159,10 @@ int main(int argc, const char * argv[])
   imageViewCreateInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
 
   VkImageView validImgView;
-  VULKAN_CHECK(vkCreateImageView(context.device, &imageViewCreateInfo, nullptr, &validImgView));
+  VULKAN_CHECK(context.deviceTable.vkCreateImageView(context.device, &imageViewCreateInfo, context.allocationCallbacks, &validImgView));
 
   VkDescriptorSet descriptorSet;
-  VULKAN_CHECK(vkAllocateDescriptorSets(context.device, &descSetAllocateInfo, &descriptorSet));
+  VULKAN_CHECK(context.deviceTable.vkAllocateDescriptorSets(context.device, &descSetAllocateInfo, &descriptorSet));
   
   VkImageView invalidImgView = (VkImageView)0x1234;
 
@@ -201,16 +199,23 @@ int main(int argc, const char * argv[])
   writeSets[1].pNext = nullptr;
   writeSets[1].pTexelBufferView = nullptr;
   VkCopyDescriptorSet copySet;
-  vkUpdateDescriptorSets(context.device, 2, writeSets, 0, &copySet);
+  context.deviceTable.vkUpdateDescriptorSets(context.device, 2, writeSets, 0, &copySet);
 
   // updates to a VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER descriptor
   // with immutable samplers does not modify the samplers
   // (the image views are updated, but the sampler updates are ignored).
   soloImageInfo.sampler = invalidSampler;
-  vkUpdateDescriptorSets(context.device, 2, writeSets, 0, &copySet);
+  context.deviceTable.vkUpdateDescriptorSets(context.device, 2, writeSets, 0, &copySet);
 
   printf("Hello, World!\n");
 
-  destroyContext(context);
-  return 1;
+  printMemoryAllocatorStats(allocator);
+
+  context.deviceTable.vkDestroyDescriptorPool(context.device, descriptorPool, context.allocationCallbacks);
+  context.deviceTable.vkDestroyImageView(context.device, validImgView, context.allocationCallbacks);
+  context.deviceTable.vkDestroyImage(context.device, validImage, context.allocationCallbacks);
+  freeMemory(allocator, imageMemory);
+  destroyMemoryAllocator(allocator);
+  context.deviceTable.vkDestroyDescriptorSetLayout(context.device, descriptorSetLayout, context.allocationCallbacks);
+  context.deviceTable.vkDestroySampler(context.device, validSampler, context.allocationCallbacks);
 }
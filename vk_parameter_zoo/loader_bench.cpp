@@ -0,0 +1,215 @@
+#include <math.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "common/common.h"
+#include "common/zoo_case.h"
+
+// Cost of one call to the same entry points through the loader's trampoline,
+// through volk's global device-level pointer and through Context::deviceTable.
+// Each path loads its pointer from memory on every call, so they differ only in
+// where the call lands.
+
+static const uint32_t Samples = 31;
+// two-sided 95% Student t for Samples - 1 degrees of freedom
+static const double StudentT95 = 2.042;
+
+struct DispatchPath
+{
+  const char *name;
+  PFN_vkGetDeviceQueue *getDeviceQueue;
+  PFN_vkUpdateDescriptorSets *updateDescriptorSets;
+  PFN_vkCmdDraw *cmdDraw;
+};
+
+struct BenchState
+{
+  Context *context;
+  VkCommandPool commandPool;
+  VkCommandBuffer commandBuffer;
+};
+
+struct BenchEntry
+{
+  const char *name;
+  uint32_t calls;
+  // returns the nanoseconds spent in calls calls, setup excluded
+  double (*time)(BenchState &state, const DispatchPath &path, uint32_t calls);
+};
+
+static double elapsedNs(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static double timeGetDeviceQueue(BenchState &state, const DispatchPath &path, uint32_t calls)
+{
+  Context &context = *state.context;
+  VkQueue queue;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < calls; ++i)
+    (*path.getDeviceQueue)(context.device, context.queueFamilyIndex, 0, &queue);
+  return elapsedNs(start);
+}
+
+static double timeUpdateDescriptorSets(BenchState &state, const DispatchPath &path, uint32_t calls)
+{
+  // empty updates keep the driver's share to its early out
+  Context &context = *state.context;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < calls; ++i)
+    (*path.updateDescriptorSets)(context.device, 0, nullptr, 0, nullptr);
+  return elapsedNs(start);
+}
+
+// binds what the base pipeline declares so the draws are valid under --debug;
+// it has no vertex inputs or descriptor sets, only possibly dynamic viewport
+// and scissor
+static void bindBasePipelineState(Context &context, VkCommandBuffer commandBuffer)
+{
+  if (context.vertexInputStateCreateInfo.vertexBindingDescriptionCount != 0)
+  {
+    fprintf(stderr, "ERROR loader_overhead draws without vertex buffers\n");
+    abort();
+  }
+
+  const VkPipelineDynamicStateCreateInfo &dynamicState = context.dynamicStateCreateInfo;
+  for (uint32_t i = 0; i < dynamicState.dynamicStateCount; ++i)
+  {
+    switch (dynamicState.pDynamicStates[i])
+    {
+    case VK_DYNAMIC_STATE_VIEWPORT:
+      context.deviceTable.vkCmdSetViewport(commandBuffer, 0, 1, &context.viewport);
+      break;
+    case VK_DYNAMIC_STATE_SCISSOR:
+      context.deviceTable.vkCmdSetScissor(commandBuffer, 0, 1, &context.scissor);
+      break;
+    default:
+      fprintf(stderr, "ERROR loader_overhead can't set dynamic state %d\n", dynamicState.pDynamicStates[i]);
+      abort();
+    }
+  }
+}
+
+static double timeCmdDraw(BenchState &state, const DispatchPath &path, uint32_t calls)
+{
+  // a render pass continuation secondary needs no framebuffer; beginning it
+  // again resets it, so recorded draws don't pile up between samples
+  Context &context = *state.context;
+  VkCommandBufferInheritanceInfo inheritanceInfo = {};
+  inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+  inheritanceInfo.renderPass = context.renderPass;
+  inheritanceInfo.subpass = 0;
+
+  VkCommandBufferBeginInfo beginInfo = {};
+  beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+  beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+  beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+  VULKAN_CHECK(context.deviceTable.vkBeginCommandBuffer(state.commandBuffer, &beginInfo));
+  context.deviceTable.vkCmdBindPipeline(state.commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, context.pipeline);
+  bindBasePipelineState(context, state.commandBuffer);
+
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < calls; ++i)
+    (*path.cmdDraw)(state.commandBuffer, 3, 1, 0, 0);
+  double ns = elapsedNs(start);
+
+  VULKAN_CHECK(context.deviceTable.vkEndCommandBuffer(state.commandBuffer));
+  return ns;
+}
+
+static const BenchEntry benchEntries[] = {
+  {"vkCmdDraw", 10000, timeCmdDraw},
+  {"vkUpdateDescriptorSets", 100000, timeUpdateDescriptorSets},
+  {"vkGetDeviceQueue", 100000, timeGetDeviceQueue},
+};
+
+ZOO_CASE(loader_overhead, RequirePipeline)
+{
+  // the timing wrappers would sit on the volk and table paths but not on the
+  // trampolines, so the paths would no longer be comparable
+  if (context.profileCalls)
+  {
+    fprintf(stderr, "ERROR loader_overhead can't run with --profile-calls\n");
+    abort();
+  }
+
+  // loader trampolines are what vkGetInstanceProcAddr hands out for
+  // device-level commands; with --icd there is no loader to measure
+  VolkDeviceTable trampolines = {};
+  trampolines.vkGetDeviceQueue = (PFN_vkGetDeviceQueue)vkGetInstanceProcAddr(context.instance, "vkGetDeviceQueue");
+  trampolines.vkUpdateDescriptorSets =
+      (PFN_vkUpdateDescriptorSets)vkGetInstanceProcAddr(context.instance, "vkUpdateDescriptorSets");
+  trampolines.vkCmdDraw = (PFN_vkCmdDraw)vkGetInstanceProcAddr(context.instance, "vkCmdDraw");
+
+  // Context never loads volk's device-level globals; this executable runs a
+  // single Context, so it's safe to point them at the device here
+  volkLoadDevice(context.device);
+
+  std::vector<DispatchPath> paths;
+  if (context.icdPath.empty())
+    paths.push_back({"loader", &trampolines.vkGetDeviceQueue, &trampolines.vkUpdateDescriptorSets,
+                     &trampolines.vkCmdDraw});
+  paths.push_back({"volk global", &vkGetDeviceQueue, &vkUpdateDescriptorSets, &vkCmdDraw});
+  paths.push_back({"device table", &context.deviceTable.vkGetDeviceQueue, &context.deviceTable.vkUpdateDescriptorSets,
+                   &context.deviceTable.vkCmdDraw});
+
+  BenchState state = {&context};
+  VkCommandPoolCreateInfo poolCreateInfo = {};
+  poolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+  poolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+  poolCreateInfo.queueFamilyIndex = context.queueFamilyIndex;
+  VULKAN_CHECK(context.deviceTable.vkCreateCommandPool(context.device, &poolCreateInfo, context.allocationCallbacks,
+                                                       &state.commandPool));
+
+  VkCommandBufferAllocateInfo allocateInfo = {};
+  allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+  allocateInfo.commandPool = state.commandPool;
+  allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+  allocateInfo.commandBufferCount = 1;
+  VULKAN_CHECK(context.deviceTable.vkAllocateCommandBuffers(context.device, &allocateInfo, &state.commandBuffer));
+
+  createPipeline(context);
+
+  printf("%-24s %-14s %10s %10s %10s\n", "loader_overhead", "path", "ns/call", "+-95%", "min");
+  for (const BenchEntry &entry : benchEntries)
+  {
+    // one warm-up pass per path resolves lazy thunks and faults in the code
+    for (const DispatchPath &path : paths)
+      entry.time(state, path, entry.calls);
+
+    // samples are interleaved across paths, rotating the order, so drift in
+    // clocks or caches lands on every path alike
+    std::vector<std::vector<double>> samples(paths.size());
+    for (uint32_t sample = 0; sample < Samples; ++sample)
+    {
+      for (size_t i = 0; i < paths.size(); ++i)
+      {
+        size_t p = (sample + i) % paths.size();
+        samples[p].push_back(entry.time(state, paths[p], entry.calls) / entry.calls);
+      }
+    }
+
+    for (size_t p = 0; p < paths.size(); ++p)
+    {
+      double mean = 0.0;
+      for (double ns : samples[p])
+        mean += ns;
+      mean /= Samples;
+      double variance = 0.0;
+      for (double ns : samples[p])
+        variance += (ns - mean) * (ns - mean);
+      variance /= Samples - 1;
+      double halfWidth = StudentT95 * sqrt(variance / Samples);
+      double min = *std::min_element(samples[p].begin(), samples[p].end());
+      printf("%-24s %-14s %10.2f %10.2f %10.2f\n", entry.name, paths[p].name, mean, halfWidth, min);
+    }
+  }
+
+  destroyPipeline(context);
+  context.deviceTable.vkFreeCommandBuffers(context.device, state.commandPool, 1, &state.commandBuffer);
+  context.deviceTable.vkDestroyCommandPool(context.device, state.commandPool, context.allocationCallbacks);
+}
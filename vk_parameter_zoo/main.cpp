@@ -0,0 +1,127 @@
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "common/common.h"
+#include "common/fan_out.h"
+#include "common/fork_server.h"
+#include "common/scheduler.h"
+#include "common/zoo_case.h"
+
+static std::vector<ZooCaseResult> runInProcess(int argc, const char *argv[],
+                                               const std::vector<const ZooCase *> &cases)
+{
+  // one instance and device shared by every case, the rest is created the
+  // first time a case asks for it
+  Context context(argc, argv);
+  ensureContext(context, RequireDevice | (getZooCaseRequirements(cases) & RequireInstanceMask));
+
+  std::vector<ZooCaseResult> results;
+  for (const ZooCase *zooCase : cases)
+  {
+    printf("[ RUN  ] %s\n", zooCase->name);
+    auto start = std::chrono::steady_clock::now();
+
+    runZooCase(context, zooCase);
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    results.push_back({zooCase, ZooCaseStatus::Passed, 0, ms});
+    printZooCaseResult(results.back());
+  }
+
+  destroyContext(context);
+  return results;
+}
+
+int main(int argc, const char * argv[])
+{
+  const char *filter = "*";
+  bool listOnly = false;
+  bool forkServer = false;
+  ForkServerOptions forkOptions;
+  bool scheduler = false;
+  SchedulerOptions schedulerOptions;
+  bool fanOut = false;
+  for (int i = 1; i < argc; ++i)
+  {
+    if (strncmp(argv[i], "--filter=", 9) == 0)
+      filter = argv[i] + 9;
+    else if (strcmp(argv[i], "--list") == 0)
+      listOnly = true;
+    else if (strcmp(argv[i], "--fork") == 0 || strcmp(argv[i], "--fork=auto") == 0)
+    {
+      forkServer = true;
+    }
+    else if (strcmp(argv[i], "--fork=warm") == 0)
+    {
+      forkServer = true;
+      forkOptions.mode = ForkMode::Warm;
+    }
+    else if (strcmp(argv[i], "--fork=fresh") == 0)
+    {
+      forkServer = true;
+      forkOptions.mode = ForkMode::Fresh;
+    }
+    else if (strncmp(argv[i], "--timeout=", 10) == 0)
+    {
+      forkOptions.timeoutSeconds = atof(argv[i] + 10);
+      schedulerOptions.timeoutSeconds = forkOptions.timeoutSeconds;
+    }
+    else if (strcmp(argv[i], "--jobs") == 0)
+    {
+      scheduler = true;
+    }
+    else if (strncmp(argv[i], "--jobs=", 7) == 0)
+    {
+      scheduler = true;
+      schedulerOptions.workerCount = atoi(argv[i] + 7);
+    }
+    else if (strncmp(argv[i], "--durations=", 12) == 0)
+    {
+      schedulerOptions.durationsPath = argv[i] + 12;
+    }
+    else if (strcmp(argv[i], "--fan-out") == 0)
+    {
+      fanOut = true;
+    }
+  }
+
+  std::vector<const ZooCase *> cases = findZooCases(filter);
+  if (listOnly)
+  {
+    for (const ZooCase *zooCase : cases)
+      printf("%s\n", zooCase->name);
+    return 0;
+  }
+
+  if (cases.empty())
+  {
+    fprintf(stderr, "No cases match '%s'\n", filter);
+    return 1;
+  }
+
+  if (fanOut && (scheduler || forkServer))
+  {
+    fprintf(stderr, "--fan-out runs in process, it can't be combined with --fork or --jobs\n");
+    return 1;
+  }
+
+  std::vector<ZooCaseResult> results;
+  if (fanOut)
+    results = runFanOut(argc, argv, cases);
+  else if (scheduler)
+    results = runScheduler(argc, argv, cases, schedulerOptions);
+  else if (forkServer)
+    results = runForkServer(argc, argv, cases, forkOptions);
+  else
+    results = runInProcess(argc, argv, cases);
+
+  int failures = 0;
+  for (const ZooCaseResult &result : results)
+  {
+    if (result.status != ZooCaseStatus::Passed)
+      failures++;
+  }
+  if (failures)
+    printf("%d of %zu cases did not pass\n", failures, results.size());
+  return failures ? 1 : 0;
+}
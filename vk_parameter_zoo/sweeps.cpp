@@ -0,0 +1,38 @@
+#include "common/canary.h"
+#include "common/common.h"
+#include "common/guard_pages.h"
+#include "common/mutation.h"
+#include "common/zoo_case.h"
+
+ZOO_CASE(mutation_sweep, RequirePipeline)
+{
+  /*
+   every combination of up to two ignored fields poisoned at once
+   */
+  std::vector<Mutation> mutations = generateMutations(context, 2);
+  printf("mutation_sweep: %zu unique states\n", mutations.size());
+
+  if (context.guardPages)
+  {
+    // serial, so every fault belongs to exactly one probe
+    for (const GuardPageProbe &probe : runGuardPageProbes(context, mutations))
+    {
+      for (const GuardPageHit &hit : probe.hits)
+        printf("mutation_sweep: %s dereferenced %s\n", describeMutation(probe.mutation).c_str(), hit.name);
+    }
+    return;
+  }
+
+  MutationBatch batch = runMutations(context, mutations, getThreadBudget(context));
+  printPipelineVariantStats(batch.stats);
+  destroyPipelineVariants(context, batch.stats);
+}
+
+ZOO_CASE(canary_sweep, RequirePipeline)
+{
+  /*
+   ignored by-value state must not change what the driver compiles
+   */
+  CanaryReport report = runCanaryProbes(context, getThreadBudget(context));
+  printCanaryReport(report);
+}
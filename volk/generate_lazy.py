@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""Regenerate the symbol lists in volk_lazy.cpp from volk.c.
+
+Copies the VOLK_GENERATE_LOAD_INSTANCE, _DEVICE and _DEVICE_TABLE sections
+of volk.c, keeping their #if guards, as VOLK_LAZY_GLOBAL / VOLK_LAZY_TABLE
+entries. Run it after updating volk:
+
+  generate_lazy.py volk/volk.c volk/volk_lazy.cpp
+"""
+import re
+import sys
+
+LOAD = re.compile(r"^\t(table->)?(\w+) = \(PFN_\w+\)load\(context, \"\w+\"\);$")
+
+SECTIONS = [
+    ("VOLK_GENERATE_LOAD_INSTANCE", "VOLK_GENERATE_LAZY_INSTANCE", "\tVOLK_LAZY_GLOBAL(%s, LazyInstance);"),
+    ("VOLK_GENERATE_LOAD_DEVICE", "VOLK_GENERATE_LAZY_DEVICE", "\tVOLK_LAZY_GLOBAL(%s, LazyDevice);"),
+    ("VOLK_GENERATE_LOAD_DEVICE_TABLE", "VOLK_GENERATE_LAZY_DEVICE_TABLE", "\tVOLK_LAZY_TABLE(%s);"),
+]
+
+
+def section(text, marker):
+    begin = "\t/* %s */\n" % marker
+    parts = text.split(begin)
+    if len(parts) != 3:
+        sys.exit("expected exactly one %s section" % marker)
+    return parts
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    with open(sys.argv[1]) as f:
+        volk = f.read()
+    with open(sys.argv[2]) as f:
+        lazy = f.read()
+
+    for source, target, entry in SECTIONS:
+        lines = []
+        for line in section(volk, source)[1].splitlines():
+            match = LOAD.match(line)
+            if match:
+                lines.append(entry % match.group(2))
+            elif line.startswith("#"):
+                lines.append(line)
+            else:
+                sys.exit("unexpected line in %s: %s" % (source, line))
+        before, _, after = section(lazy, target)
+        marker = "\t/* %s */\n" % target
+        lazy = before + marker + "".join(l + "\n" for l in lines) + marker + after
+
+    with open(sys.argv[2], "w") as f:
+        f.write(lazy)
+
+
+if __name__ == "__main__":
+    main()
@@ -24,6 +24,11 @@ __declspec(dllimport) HMODULE __stdcall LoadLibraryA(LPCSTR);
 __declspec(dllimport) FARPROC __stdcall GetProcAddress(HMODULE, LPCSTR);
 #endif
 
+/* newest loader-ICD interface version known to volkInitializeFromICD */
+#define VOLK_ICD_INTERFACE_VERSION 7
+
+typedef VkResult (VKAPI_PTR *PFN_volkNegotiateLoaderICDInterfaceVersion)(uint32_t* pSupportedVersion);
+
 static VkInstance loadedInstance = VK_NULL_HANDLE;
 static VkDevice loadedDevice = VK_NULL_HANDLE;
 
@@ -32,6 +37,10 @@ static void volkGenLoadInstance(void* context, PFN_vkVoidFunction (*load)(void*,
 static void volkGenLoadDevice(void* context, PFN_vkVoidFunction (*load)(void*, const char*));
 static void volkGenLoadDeviceTable(struct VolkDeviceTable* table, void* context, PFN_vkVoidFunction (*load)(void*, const char*));
 
+/* volk_lazy.cpp */
+void volkLazyLoadInstance(VkInstance instance, int instanceOnly);
+void volkLazyLoadDevice(VkDevice device);
+
 static PFN_vkVoidFunction vkGetInstanceProcAddrStub(void* context, const char* name)
 {
 	return vkGetInstanceProcAddr((VkInstance)context, name);
@@ -83,6 +92,47 @@ void volkInitializeCustom(PFN_vkGetInstanceProcAddr handler)
 	volkGenLoadLoader(NULL, vkGetInstanceProcAddrStub);
 }
 
+VkResult volkInitializeFromICD(const char* path)
+{
+#if defined(_WIN32)
+	HMODULE module = LoadLibraryA(path);
+	if (!module)
+		return VK_ERROR_INITIALIZATION_FAILED;
+
+	PFN_volkNegotiateLoaderICDInterfaceVersion negotiate = (PFN_volkNegotiateLoaderICDInterfaceVersion)(void(*)(void))GetProcAddress(module, "vk_icdNegotiateLoaderICDInterfaceVersion");
+	PFN_vkGetInstanceProcAddr getInstanceProcAddr = (PFN_vkGetInstanceProcAddr)(void(*)(void))GetProcAddress(module, "vk_icdGetInstanceProcAddr");
+	if (!getInstanceProcAddr)
+		getInstanceProcAddr = (PFN_vkGetInstanceProcAddr)(void(*)(void))GetProcAddress(module, "vkGetInstanceProcAddr");
+#else
+	void* module = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+	if (!module)
+		return VK_ERROR_INITIALIZATION_FAILED;
+
+	PFN_volkNegotiateLoaderICDInterfaceVersion negotiate = (PFN_volkNegotiateLoaderICDInterfaceVersion)dlsym(module, "vk_icdNegotiateLoaderICDInterfaceVersion");
+	PFN_vkGetInstanceProcAddr getInstanceProcAddr = (PFN_vkGetInstanceProcAddr)dlsym(module, "vk_icdGetInstanceProcAddr");
+	/* interface version 0 drivers only export the regular entry point */
+	if (!getInstanceProcAddr)
+		getInstanceProcAddr = (PFN_vkGetInstanceProcAddr)dlsym(module, "vkGetInstanceProcAddr");
+#endif
+
+	if (!getInstanceProcAddr)
+		return VK_ERROR_INITIALIZATION_FAILED;
+
+	/* no loader sits between the application and the driver, so offer the newest interface; the driver
+	 * picks the version it implements and keeps the loader magic in its dispatchable handles
+	 */
+	if (negotiate)
+	{
+		uint32_t interfaceVersion = VOLK_ICD_INTERFACE_VERSION;
+		if (negotiate(&interfaceVersion) != VK_SUCCESS)
+			return VK_ERROR_INCOMPATIBLE_DRIVER;
+	}
+
+	volkInitializeCustom(getInstanceProcAddr);
+
+	return VK_SUCCESS;
+}
+
 uint32_t volkGetInstanceVersion(void)
 {
 #if defined(VK_VERSION_1_1)
@@ -110,6 +160,18 @@ void volkLoadInstanceOnly(VkInstance instance)
     volkGenLoadInstance(instance, vkGetInstanceProcAddrStub);
 }
 
+void volkLoadInstanceLazy(VkInstance instance)
+{
+	loadedInstance = instance;
+	volkLazyLoadInstance(instance, 0);
+}
+
+void volkLoadInstanceOnlyLazy(VkInstance instance)
+{
+	loadedInstance = instance;
+	volkLazyLoadInstance(instance, 1);
+}
+
 VkInstance volkGetLoadedInstance()
 {
 	return loadedInstance;
@@ -121,6 +183,12 @@ void volkLoadDevice(VkDevice device)
 	volkGenLoadDevice(device, vkGetDeviceProcAddrStub);
 }
 
+void volkLoadDeviceLazy(VkDevice device)
+{
+	loadedDevice = device;
+	volkLazyLoadDevice(device);
+}
+
 VkDevice volkGetLoadedDevice()
 {
 	return loadedDevice;
@@ -81,6 +81,18 @@ VkResult volkInitialize(void);
  */
 void volkInitializeCustom(PFN_vkGetInstanceProcAddr handler);
 
+/**
+ * Initialize library by loading a Vulkan driver (ICD) directly, bypassing the Vulkan loader; path is the driver library,
+ * e.g. libvulkan_lvp.so, not its JSON manifest. This function can be used instead of volkInitialize.
+ * The loader-ICD interface version is negotiated when the driver supports it, then vk_icdGetInstanceProcAddr
+ * is used as vkGetInstanceProcAddr, so volkLoadInstance and volkLoadDevice work as usual.
+ *
+ * Note: layers are not available, and surfaces need a driver that implements interface version 3 or newer.
+ *
+ * Returns VK_SUCCESS on success, VK_ERROR_INCOMPATIBLE_DRIVER if the negotiation fails and VK_ERROR_INITIALIZATION_FAILED otherwise.
+ */
+VkResult volkInitializeFromICD(const char* path);
+
 /**
  * Get Vulkan instance version supported by the Vulkan loader, or 0 if Vulkan isn't supported
  *
@@ -124,6 +136,33 @@ VkDevice volkGetLoadedDevice(void);
  */
 void volkLoadDeviceTable(struct VolkDeviceTable* table, VkDevice device);
 
+/**
+ * Lazy variants of volkLoadInstance, volkLoadInstanceOnly, volkLoadDevice and volkLoadDeviceTable (volk_lazy.cpp).
+ * Every function pointer starts as a thunk that resolves the real entry point on first call and patches itself,
+ * so only the entry points that are actually called are looked up.
+ *
+ * Note: the pointers are never NULL, calling an entry point that can't be resolved aborts; check the enabled
+ * version and extensions instead of testing the pointer.
+ *
+ * Note: a global thunk patches itself with an atomic store while other threads may load the same global with a plain
+ * load. This is a benign race: every thread sees either the thunk or the resolved pointer, both of which forward to
+ * the same entry point, and pointer-sized aligned stores don't tear on any platform volk supports.
+ *
+ * Note: table thunks find their table through the loader's dispatch pointer in the first word of the device, queue
+ * or command buffer handle. Without the loader (volkInitializeFromICD) every handle carries the same magic value,
+ * so loading a second device's table aborts.
+ */
+void volkLoadInstanceLazy(VkInstance instance);
+void volkLoadInstanceOnlyLazy(VkInstance instance);
+void volkLoadDeviceLazy(VkDevice device);
+void volkLoadDeviceTableLazy(struct VolkDeviceTable* table, VkDevice device);
+
+/**
+ * Forget a table loaded with volkLoadDeviceTableLazy; call this before the table's memory is freed or its device is destroyed.
+ * Thunks still in the table abort when called afterwards.
+ */
+void volkUnloadDeviceTableLazy(struct VolkDeviceTable* table);
+
 /**
  * Device-specific function pointer table
  */
@@ -0,0 +1,1651 @@
+/* Lazy variants of volkLoadInstance, volkLoadDevice and volkLoadDeviceTable; see volk.h */
+/* clang-format off */
+#include "volk.h"
+
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Every pointer starts as a thunk that resolves the real entry point on first call, patches the pointer
+ * with an atomic store and forwards the call, so a process only pays for the entry points it uses.
+ * The symbol lists are generated from volk.c by generate_lazy.py.
+ */
+
+namespace
+{
+
+enum LazyLoader
+{
+	LazyInstance,
+	LazyDevice,
+};
+
+struct LazySymbol
+{
+	const char* name;
+	LazyLoader loader;
+};
+
+struct LazyTable
+{
+	void* dispatchKey;
+	VkDevice device;
+	VolkDeviceTable* table;
+};
+
+VkInstance lazyInstance = VK_NULL_HANDLE;
+/* VK_NULL_HANDLE while device-level globals go through the instance (volkLoadInstanceLazy) */
+VkDevice lazyDevice = VK_NULL_HANDLE;
+
+std::mutex lazyTablesLock;
+LazyTable lazyTables[64];
+size_t lazyTableCount = 0;
+
+/* the loader stores its dispatch table pointer in the first word of every dispatchable handle, which
+ * the device shares with its queues and command buffers
+ */
+template <typename Handle>
+void* getDispatchKey(Handle handle)
+{
+	return *(void**)handle;
+}
+
+template <typename First, typename... Rest>
+void* getFirstDispatchKey(First first, Rest...)
+{
+	return getDispatchKey(first);
+}
+
+[[noreturn]] void lazyMissing(const char* name)
+{
+	fprintf(stderr, "volk: %s is not available, check the enabled version and extensions\n", name);
+	abort();
+}
+
+PFN_vkVoidFunction resolveGlobal(const LazySymbol* symbol)
+{
+	PFN_vkVoidFunction function = (symbol->loader == LazyDevice && lazyDevice)
+		? vkGetDeviceProcAddr(lazyDevice, symbol->name)
+		: vkGetInstanceProcAddr(lazyInstance, symbol->name);
+	if (!function)
+		lazyMissing(symbol->name);
+	return function;
+}
+
+template <typename Function>
+struct LazyThunk;
+
+template <typename R, typename... Args>
+struct LazyThunk<R (VKAPI_PTR*)(Args...)>
+{
+	typedef R (VKAPI_PTR* Function)(Args...);
+
+	template <Function* Slot, const LazySymbol* Symbol>
+	static R VKAPI_PTR global(Args... args)
+	{
+		Function function = (Function)resolveGlobal(Symbol);
+		/* callers load volk's globals with plain loads; benign, see volk.h */
+		__atomic_store_n(Slot, function, __ATOMIC_RELEASE);
+		return function(args...);
+	}
+
+	template <Function VolkDeviceTable::*Member, const LazySymbol* Symbol>
+	static R VKAPI_PTR table(Args... args)
+	{
+		Function function = (Function)resolveTable(getFirstDispatchKey(args...), Symbol->name,
+			[](VolkDeviceTable* slots, PFN_vkVoidFunction resolved) {
+				/* leave the slot alone if it was reloaded or wrapped since */
+				Function expected = &table<Member, Symbol>;
+				__atomic_compare_exchange_n(&(slots->*Member), &expected, (Function)resolved, false,
+					__ATOMIC_RELEASE, __ATOMIC_RELAXED);
+			});
+		return function(args...);
+	}
+
+	template <typename Patch>
+	static PFN_vkVoidFunction resolveTable(void* dispatchKey, const char* name, Patch patch)
+	{
+		std::lock_guard<std::mutex> lock(lazyTablesLock);
+		PFN_vkVoidFunction function = NULL;
+		for (size_t i = 0; i < lazyTableCount; ++i)
+		{
+			if (lazyTables[i].dispatchKey != dispatchKey)
+				continue;
+			if (!function)
+				function = vkGetDeviceProcAddr(lazyTables[i].device, name);
+			if (!function)
+				lazyMissing(name);
+			patch(lazyTables[i].table, function);
+		}
+		if (!function)
+		{
+			fprintf(stderr, "volk: %s called on a handle from a device without a lazy table\n", name);
+			abort();
+		}
+		return function;
+	}
+};
+
+} // namespace
+
+#define VOLK_LAZY_GLOBAL(name, loader) \
+	do \
+	{ \
+		static const LazySymbol symbol = {#name, loader}; \
+		__atomic_store_n(&name, &LazyThunk<PFN_##name>::global<&name, &symbol>, __ATOMIC_RELEASE); \
+	} while (0)
+
+#define VOLK_LAZY_TABLE(name) \
+	do \
+	{ \
+		static const LazySymbol symbol = {#name, LazyDevice}; \
+		table->name = &LazyThunk<PFN_##name>::table<&VolkDeviceTable::name, &symbol>; \
+	} while (0)
+
+static void volkGenLoadInstanceLazy(void)
+{
+	/* VOLK_GENERATE_LAZY_INSTANCE */
+#if defined(VK_VERSION_1_0)
+	VOLK_LAZY_GLOBAL(vkCreateDevice, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkDestroyInstance, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkEnumerateDeviceExtensionProperties, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkEnumerateDeviceLayerProperties, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkEnumeratePhysicalDevices, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetDeviceProcAddr, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceFeatures, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceFormatProperties, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceImageFormatProperties, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceMemoryProperties, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceProperties, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceQueueFamilyProperties, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceSparseImageFormatProperties, LazyInstance);
+#endif /* defined(VK_VERSION_1_0) */
+#if defined(VK_VERSION_1_1)
+	VOLK_LAZY_GLOBAL(vkEnumeratePhysicalDeviceGroups, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceExternalBufferProperties, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceExternalFenceProperties, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceExternalSemaphoreProperties, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceFeatures2, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceFormatProperties2, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceImageFormatProperties2, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceMemoryProperties2, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceProperties2, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceQueueFamilyProperties2, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceSparseImageFormatProperties2, LazyInstance);
+#endif /* defined(VK_VERSION_1_1) */
+#if defined(VK_VERSION_1_3)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceToolProperties, LazyInstance);
+#endif /* defined(VK_VERSION_1_3) */
+#if defined(VK_EXT_acquire_drm_display)
+	VOLK_LAZY_GLOBAL(vkAcquireDrmDisplayEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetDrmDisplayEXT, LazyInstance);
+#endif /* defined(VK_EXT_acquire_drm_display) */
+#if defined(VK_EXT_acquire_xlib_display)
+	VOLK_LAZY_GLOBAL(vkAcquireXlibDisplayEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetRandROutputDisplayEXT, LazyInstance);
+#endif /* defined(VK_EXT_acquire_xlib_display) */
+#if defined(VK_EXT_calibrated_timestamps)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceCalibrateableTimeDomainsEXT, LazyInstance);
+#endif /* defined(VK_EXT_calibrated_timestamps) */
+#if defined(VK_EXT_debug_report)
+	VOLK_LAZY_GLOBAL(vkCreateDebugReportCallbackEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkDebugReportMessageEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkDestroyDebugReportCallbackEXT, LazyInstance);
+#endif /* defined(VK_EXT_debug_report) */
+#if defined(VK_EXT_debug_utils)
+	VOLK_LAZY_GLOBAL(vkCmdBeginDebugUtilsLabelEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkCmdEndDebugUtilsLabelEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkCmdInsertDebugUtilsLabelEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkCreateDebugUtilsMessengerEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkDestroyDebugUtilsMessengerEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkQueueBeginDebugUtilsLabelEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkQueueEndDebugUtilsLabelEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkQueueInsertDebugUtilsLabelEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkSetDebugUtilsObjectNameEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkSetDebugUtilsObjectTagEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkSubmitDebugUtilsMessageEXT, LazyInstance);
+#endif /* defined(VK_EXT_debug_utils) */
+#if defined(VK_EXT_direct_mode_display)
+	VOLK_LAZY_GLOBAL(vkReleaseDisplayEXT, LazyInstance);
+#endif /* defined(VK_EXT_direct_mode_display) */
+#if defined(VK_EXT_directfb_surface)
+	VOLK_LAZY_GLOBAL(vkCreateDirectFBSurfaceEXT, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceDirectFBPresentationSupportEXT, LazyInstance);
+#endif /* defined(VK_EXT_directfb_surface) */
+#if defined(VK_EXT_display_surface_counter)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceSurfaceCapabilities2EXT, LazyInstance);
+#endif /* defined(VK_EXT_display_surface_counter) */
+#if defined(VK_EXT_full_screen_exclusive)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceSurfacePresentModes2EXT, LazyInstance);
+#endif /* defined(VK_EXT_full_screen_exclusive) */
+#if defined(VK_EXT_headless_surface)
+	VOLK_LAZY_GLOBAL(vkCreateHeadlessSurfaceEXT, LazyInstance);
+#endif /* defined(VK_EXT_headless_surface) */
+#if defined(VK_EXT_metal_surface)
+	VOLK_LAZY_GLOBAL(vkCreateMetalSurfaceEXT, LazyInstance);
+#endif /* defined(VK_EXT_metal_surface) */
+#if defined(VK_EXT_sample_locations)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceMultisamplePropertiesEXT, LazyInstance);
+#endif /* defined(VK_EXT_sample_locations) */
+#if defined(VK_EXT_tooling_info)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceToolPropertiesEXT, LazyInstance);
+#endif /* defined(VK_EXT_tooling_info) */
+#if defined(VK_FUCHSIA_imagepipe_surface)
+	VOLK_LAZY_GLOBAL(vkCreateImagePipeSurfaceFUCHSIA, LazyInstance);
+#endif /* defined(VK_FUCHSIA_imagepipe_surface) */
+#if defined(VK_GGP_stream_descriptor_surface)
+	VOLK_LAZY_GLOBAL(vkCreateStreamDescriptorSurfaceGGP, LazyInstance);
+#endif /* defined(VK_GGP_stream_descriptor_surface) */
+#if defined(VK_KHR_android_surface)
+	VOLK_LAZY_GLOBAL(vkCreateAndroidSurfaceKHR, LazyInstance);
+#endif /* defined(VK_KHR_android_surface) */
+#if defined(VK_KHR_device_group_creation)
+	VOLK_LAZY_GLOBAL(vkEnumeratePhysicalDeviceGroupsKHR, LazyInstance);
+#endif /* defined(VK_KHR_device_group_creation) */
+#if defined(VK_KHR_display)
+	VOLK_LAZY_GLOBAL(vkCreateDisplayModeKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkCreateDisplayPlaneSurfaceKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetDisplayModePropertiesKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetDisplayPlaneCapabilitiesKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetDisplayPlaneSupportedDisplaysKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceDisplayPlanePropertiesKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceDisplayPropertiesKHR, LazyInstance);
+#endif /* defined(VK_KHR_display) */
+#if defined(VK_KHR_external_fence_capabilities)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceExternalFencePropertiesKHR, LazyInstance);
+#endif /* defined(VK_KHR_external_fence_capabilities) */
+#if defined(VK_KHR_external_memory_capabilities)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceExternalBufferPropertiesKHR, LazyInstance);
+#endif /* defined(VK_KHR_external_memory_capabilities) */
+#if defined(VK_KHR_external_semaphore_capabilities)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceExternalSemaphorePropertiesKHR, LazyInstance);
+#endif /* defined(VK_KHR_external_semaphore_capabilities) */
+#if defined(VK_KHR_fragment_shading_rate)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceFragmentShadingRatesKHR, LazyInstance);
+#endif /* defined(VK_KHR_fragment_shading_rate) */
+#if defined(VK_KHR_get_display_properties2)
+	VOLK_LAZY_GLOBAL(vkGetDisplayModeProperties2KHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetDisplayPlaneCapabilities2KHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceDisplayPlaneProperties2KHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceDisplayProperties2KHR, LazyInstance);
+#endif /* defined(VK_KHR_get_display_properties2) */
+#if defined(VK_KHR_get_physical_device_properties2)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceFeatures2KHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceFormatProperties2KHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceImageFormatProperties2KHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceMemoryProperties2KHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceProperties2KHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceQueueFamilyProperties2KHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceSparseImageFormatProperties2KHR, LazyInstance);
+#endif /* defined(VK_KHR_get_physical_device_properties2) */
+#if defined(VK_KHR_get_surface_capabilities2)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceSurfaceCapabilities2KHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceSurfaceFormats2KHR, LazyInstance);
+#endif /* defined(VK_KHR_get_surface_capabilities2) */
+#if defined(VK_KHR_performance_query)
+	VOLK_LAZY_GLOBAL(vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR, LazyInstance);
+#endif /* defined(VK_KHR_performance_query) */
+#if defined(VK_KHR_surface)
+	VOLK_LAZY_GLOBAL(vkDestroySurfaceKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceSurfaceCapabilitiesKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceSurfaceFormatsKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceSurfacePresentModesKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceSurfaceSupportKHR, LazyInstance);
+#endif /* defined(VK_KHR_surface) */
+#if defined(VK_KHR_video_queue)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceVideoCapabilitiesKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceVideoFormatPropertiesKHR, LazyInstance);
+#endif /* defined(VK_KHR_video_queue) */
+#if defined(VK_KHR_wayland_surface)
+	VOLK_LAZY_GLOBAL(vkCreateWaylandSurfaceKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceWaylandPresentationSupportKHR, LazyInstance);
+#endif /* defined(VK_KHR_wayland_surface) */
+#if defined(VK_KHR_win32_surface)
+	VOLK_LAZY_GLOBAL(vkCreateWin32SurfaceKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceWin32PresentationSupportKHR, LazyInstance);
+#endif /* defined(VK_KHR_win32_surface) */
+#if defined(VK_KHR_xcb_surface)
+	VOLK_LAZY_GLOBAL(vkCreateXcbSurfaceKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceXcbPresentationSupportKHR, LazyInstance);
+#endif /* defined(VK_KHR_xcb_surface) */
+#if defined(VK_KHR_xlib_surface)
+	VOLK_LAZY_GLOBAL(vkCreateXlibSurfaceKHR, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceXlibPresentationSupportKHR, LazyInstance);
+#endif /* defined(VK_KHR_xlib_surface) */
+#if defined(VK_MVK_ios_surface)
+	VOLK_LAZY_GLOBAL(vkCreateIOSSurfaceMVK, LazyInstance);
+#endif /* defined(VK_MVK_ios_surface) */
+#if defined(VK_MVK_macos_surface)
+	VOLK_LAZY_GLOBAL(vkCreateMacOSSurfaceMVK, LazyInstance);
+#endif /* defined(VK_MVK_macos_surface) */
+#if defined(VK_NN_vi_surface)
+	VOLK_LAZY_GLOBAL(vkCreateViSurfaceNN, LazyInstance);
+#endif /* defined(VK_NN_vi_surface) */
+#if defined(VK_NV_acquire_winrt_display)
+	VOLK_LAZY_GLOBAL(vkAcquireWinrtDisplayNV, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetWinrtDisplayNV, LazyInstance);
+#endif /* defined(VK_NV_acquire_winrt_display) */
+#if defined(VK_NV_cooperative_matrix)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceCooperativeMatrixPropertiesNV, LazyInstance);
+#endif /* defined(VK_NV_cooperative_matrix) */
+#if defined(VK_NV_coverage_reduction_mode)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV, LazyInstance);
+#endif /* defined(VK_NV_coverage_reduction_mode) */
+#if defined(VK_NV_external_memory_capabilities)
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceExternalImageFormatPropertiesNV, LazyInstance);
+#endif /* defined(VK_NV_external_memory_capabilities) */
+#if defined(VK_QNX_screen_surface)
+	VOLK_LAZY_GLOBAL(vkCreateScreenSurfaceQNX, LazyInstance);
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDeviceScreenPresentationSupportQNX, LazyInstance);
+#endif /* defined(VK_QNX_screen_surface) */
+#if (defined(VK_KHR_device_group) && defined(VK_KHR_surface)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1))
+	VOLK_LAZY_GLOBAL(vkGetPhysicalDevicePresentRectanglesKHR, LazyInstance);
+#endif /* (defined(VK_KHR_device_group) && defined(VK_KHR_surface)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) */
+	/* VOLK_GENERATE_LAZY_INSTANCE */
+}
+
+static void volkGenLoadDeviceLazy(void)
+{
+	/* VOLK_GENERATE_LAZY_DEVICE */
+#if defined(VK_VERSION_1_0)
+	VOLK_LAZY_GLOBAL(vkAllocateCommandBuffers, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkAllocateDescriptorSets, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkAllocateMemory, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkBeginCommandBuffer, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkBindBufferMemory, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkBindImageMemory, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBeginQuery, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBeginRenderPass, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBindDescriptorSets, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBindIndexBuffer, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBindPipeline, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBindVertexBuffers, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBlitImage, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdClearAttachments, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdClearColorImage, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdClearDepthStencilImage, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyBuffer, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyBufferToImage, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyImage, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyImageToBuffer, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyQueryPoolResults, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDispatch, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDispatchIndirect, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDraw, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDrawIndexed, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDrawIndexedIndirect, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDrawIndirect, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdEndQuery, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdEndRenderPass, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdExecuteCommands, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdFillBuffer, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdNextSubpass, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdPipelineBarrier, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdPushConstants, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdResetEvent, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdResetQueryPool, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdResolveImage, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetBlendConstants, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetDepthBias, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetDepthBounds, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetEvent, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetLineWidth, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetScissor, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetStencilCompareMask, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetStencilReference, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetStencilWriteMask, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetViewport, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdUpdateBuffer, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdWaitEvents, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdWriteTimestamp, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateBuffer, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateBufferView, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateCommandPool, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateComputePipelines, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateDescriptorPool, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateDescriptorSetLayout, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateEvent, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateFence, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateFramebuffer, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateGraphicsPipelines, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateImage, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateImageView, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreatePipelineCache, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreatePipelineLayout, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateQueryPool, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateRenderPass, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateSampler, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateSemaphore, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateShaderModule, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyBuffer, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyBufferView, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyCommandPool, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyDescriptorPool, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyDescriptorSetLayout, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyDevice, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyEvent, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyFence, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyFramebuffer, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyImage, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyImageView, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyPipeline, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyPipelineCache, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyPipelineLayout, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyQueryPool, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyRenderPass, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroySampler, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroySemaphore, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyShaderModule, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDeviceWaitIdle, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkEndCommandBuffer, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkFlushMappedMemoryRanges, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkFreeCommandBuffers, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkFreeDescriptorSets, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkFreeMemory, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetBufferMemoryRequirements, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceMemoryCommitment, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceQueue, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetEventStatus, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetFenceStatus, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetImageMemoryRequirements, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetImageSparseMemoryRequirements, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetImageSubresourceLayout, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetPipelineCacheData, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetQueryPoolResults, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetRenderAreaGranularity, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkInvalidateMappedMemoryRanges, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkMapMemory, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkMergePipelineCaches, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkQueueBindSparse, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkQueueSubmit, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkQueueWaitIdle, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkResetCommandBuffer, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkResetCommandPool, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkResetDescriptorPool, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkResetEvent, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkResetFences, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkSetEvent, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkUnmapMemory, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkUpdateDescriptorSets, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkWaitForFences, LazyDevice);
+#endif /* defined(VK_VERSION_1_0) */
+#if defined(VK_VERSION_1_1)
+	VOLK_LAZY_GLOBAL(vkBindBufferMemory2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkBindImageMemory2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDispatchBase, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetDeviceMask, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateDescriptorUpdateTemplate, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateSamplerYcbcrConversion, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyDescriptorUpdateTemplate, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroySamplerYcbcrConversion, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetBufferMemoryRequirements2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDescriptorSetLayoutSupport, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceGroupPeerMemoryFeatures, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceQueue2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetImageMemoryRequirements2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetImageSparseMemoryRequirements2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkTrimCommandPool, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkUpdateDescriptorSetWithTemplate, LazyDevice);
+#endif /* defined(VK_VERSION_1_1) */
+#if defined(VK_VERSION_1_2)
+	VOLK_LAZY_GLOBAL(vkCmdBeginRenderPass2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDrawIndexedIndirectCount, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDrawIndirectCount, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdEndRenderPass2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdNextSubpass2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateRenderPass2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetBufferDeviceAddress, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetBufferOpaqueCaptureAddress, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceMemoryOpaqueCaptureAddress, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetSemaphoreCounterValue, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkResetQueryPool, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkSignalSemaphore, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkWaitSemaphores, LazyDevice);
+#endif /* defined(VK_VERSION_1_2) */
+#if defined(VK_VERSION_1_3)
+	VOLK_LAZY_GLOBAL(vkCmdBeginRendering, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBindVertexBuffers2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBlitImage2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyBuffer2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyBufferToImage2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyImage2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyImageToBuffer2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdEndRendering, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdPipelineBarrier2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdResetEvent2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdResolveImage2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetCullMode, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetDepthBiasEnable, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetDepthBoundsTestEnable, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetDepthCompareOp, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetDepthTestEnable, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetDepthWriteEnable, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetEvent2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetFrontFace, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetPrimitiveRestartEnable, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetPrimitiveTopology, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetRasterizerDiscardEnable, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetScissorWithCount, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetStencilOp, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetStencilTestEnable, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetViewportWithCount, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdWaitEvents2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdWriteTimestamp2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreatePrivateDataSlot, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyPrivateDataSlot, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceBufferMemoryRequirements, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceImageMemoryRequirements, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceImageSparseMemoryRequirements, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetPrivateData, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkQueueSubmit2, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkSetPrivateData, LazyDevice);
+#endif /* defined(VK_VERSION_1_3) */
+#if defined(VK_AMD_buffer_marker)
+	VOLK_LAZY_GLOBAL(vkCmdWriteBufferMarkerAMD, LazyDevice);
+#endif /* defined(VK_AMD_buffer_marker) */
+#if defined(VK_AMD_display_native_hdr)
+	VOLK_LAZY_GLOBAL(vkSetLocalDimmingAMD, LazyDevice);
+#endif /* defined(VK_AMD_display_native_hdr) */
+#if defined(VK_AMD_draw_indirect_count)
+	VOLK_LAZY_GLOBAL(vkCmdDrawIndexedIndirectCountAMD, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDrawIndirectCountAMD, LazyDevice);
+#endif /* defined(VK_AMD_draw_indirect_count) */
+#if defined(VK_AMD_shader_info)
+	VOLK_LAZY_GLOBAL(vkGetShaderInfoAMD, LazyDevice);
+#endif /* defined(VK_AMD_shader_info) */
+#if defined(VK_ANDROID_external_memory_android_hardware_buffer)
+	VOLK_LAZY_GLOBAL(vkGetAndroidHardwareBufferPropertiesANDROID, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetMemoryAndroidHardwareBufferANDROID, LazyDevice);
+#endif /* defined(VK_ANDROID_external_memory_android_hardware_buffer) */
+#if defined(VK_EXT_buffer_device_address)
+	VOLK_LAZY_GLOBAL(vkGetBufferDeviceAddressEXT, LazyDevice);
+#endif /* defined(VK_EXT_buffer_device_address) */
+#if defined(VK_EXT_calibrated_timestamps)
+	VOLK_LAZY_GLOBAL(vkGetCalibratedTimestampsEXT, LazyDevice);
+#endif /* defined(VK_EXT_calibrated_timestamps) */
+#if defined(VK_EXT_color_write_enable)
+	VOLK_LAZY_GLOBAL(vkCmdSetColorWriteEnableEXT, LazyDevice);
+#endif /* defined(VK_EXT_color_write_enable) */
+#if defined(VK_EXT_conditional_rendering)
+	VOLK_LAZY_GLOBAL(vkCmdBeginConditionalRenderingEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdEndConditionalRenderingEXT, LazyDevice);
+#endif /* defined(VK_EXT_conditional_rendering) */
+#if defined(VK_EXT_debug_marker)
+	VOLK_LAZY_GLOBAL(vkCmdDebugMarkerBeginEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDebugMarkerEndEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDebugMarkerInsertEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDebugMarkerSetObjectNameEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDebugMarkerSetObjectTagEXT, LazyDevice);
+#endif /* defined(VK_EXT_debug_marker) */
+#if defined(VK_EXT_discard_rectangles)
+	VOLK_LAZY_GLOBAL(vkCmdSetDiscardRectangleEXT, LazyDevice);
+#endif /* defined(VK_EXT_discard_rectangles) */
+#if defined(VK_EXT_display_control)
+	VOLK_LAZY_GLOBAL(vkDisplayPowerControlEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetSwapchainCounterEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkRegisterDeviceEventEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkRegisterDisplayEventEXT, LazyDevice);
+#endif /* defined(VK_EXT_display_control) */
+#if defined(VK_EXT_extended_dynamic_state)
+	VOLK_LAZY_GLOBAL(vkCmdBindVertexBuffers2EXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetCullModeEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetDepthBoundsTestEnableEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetDepthCompareOpEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetDepthTestEnableEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetDepthWriteEnableEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetFrontFaceEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetPrimitiveTopologyEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetScissorWithCountEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetStencilOpEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetStencilTestEnableEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetViewportWithCountEXT, LazyDevice);
+#endif /* defined(VK_EXT_extended_dynamic_state) */
+#if defined(VK_EXT_extended_dynamic_state2)
+	VOLK_LAZY_GLOBAL(vkCmdSetDepthBiasEnableEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetLogicOpEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetPatchControlPointsEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetPrimitiveRestartEnableEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetRasterizerDiscardEnableEXT, LazyDevice);
+#endif /* defined(VK_EXT_extended_dynamic_state2) */
+#if defined(VK_EXT_external_memory_host)
+	VOLK_LAZY_GLOBAL(vkGetMemoryHostPointerPropertiesEXT, LazyDevice);
+#endif /* defined(VK_EXT_external_memory_host) */
+#if defined(VK_EXT_full_screen_exclusive)
+	VOLK_LAZY_GLOBAL(vkAcquireFullScreenExclusiveModeEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkReleaseFullScreenExclusiveModeEXT, LazyDevice);
+#endif /* defined(VK_EXT_full_screen_exclusive) */
+#if defined(VK_EXT_hdr_metadata)
+	VOLK_LAZY_GLOBAL(vkSetHdrMetadataEXT, LazyDevice);
+#endif /* defined(VK_EXT_hdr_metadata) */
+#if defined(VK_EXT_host_query_reset)
+	VOLK_LAZY_GLOBAL(vkResetQueryPoolEXT, LazyDevice);
+#endif /* defined(VK_EXT_host_query_reset) */
+#if defined(VK_EXT_image_drm_format_modifier)
+	VOLK_LAZY_GLOBAL(vkGetImageDrmFormatModifierPropertiesEXT, LazyDevice);
+#endif /* defined(VK_EXT_image_drm_format_modifier) */
+#if defined(VK_EXT_line_rasterization)
+	VOLK_LAZY_GLOBAL(vkCmdSetLineStippleEXT, LazyDevice);
+#endif /* defined(VK_EXT_line_rasterization) */
+#if defined(VK_EXT_multi_draw)
+	VOLK_LAZY_GLOBAL(vkCmdDrawMultiEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDrawMultiIndexedEXT, LazyDevice);
+#endif /* defined(VK_EXT_multi_draw) */
+#if defined(VK_EXT_pageable_device_local_memory)
+	VOLK_LAZY_GLOBAL(vkSetDeviceMemoryPriorityEXT, LazyDevice);
+#endif /* defined(VK_EXT_pageable_device_local_memory) */
+#if defined(VK_EXT_private_data)
+	VOLK_LAZY_GLOBAL(vkCreatePrivateDataSlotEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyPrivateDataSlotEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetPrivateDataEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkSetPrivateDataEXT, LazyDevice);
+#endif /* defined(VK_EXT_private_data) */
+#if defined(VK_EXT_sample_locations)
+	VOLK_LAZY_GLOBAL(vkCmdSetSampleLocationsEXT, LazyDevice);
+#endif /* defined(VK_EXT_sample_locations) */
+#if defined(VK_EXT_transform_feedback)
+	VOLK_LAZY_GLOBAL(vkCmdBeginQueryIndexedEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBeginTransformFeedbackEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBindTransformFeedbackBuffersEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDrawIndirectByteCountEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdEndQueryIndexedEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdEndTransformFeedbackEXT, LazyDevice);
+#endif /* defined(VK_EXT_transform_feedback) */
+#if defined(VK_EXT_validation_cache)
+	VOLK_LAZY_GLOBAL(vkCreateValidationCacheEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyValidationCacheEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetValidationCacheDataEXT, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkMergeValidationCachesEXT, LazyDevice);
+#endif /* defined(VK_EXT_validation_cache) */
+#if defined(VK_EXT_vertex_input_dynamic_state)
+	VOLK_LAZY_GLOBAL(vkCmdSetVertexInputEXT, LazyDevice);
+#endif /* defined(VK_EXT_vertex_input_dynamic_state) */
+#if defined(VK_FUCHSIA_buffer_collection)
+	VOLK_LAZY_GLOBAL(vkCreateBufferCollectionFUCHSIA, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyBufferCollectionFUCHSIA, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetBufferCollectionPropertiesFUCHSIA, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkSetBufferCollectionBufferConstraintsFUCHSIA, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkSetBufferCollectionImageConstraintsFUCHSIA, LazyDevice);
+#endif /* defined(VK_FUCHSIA_buffer_collection) */
+#if defined(VK_FUCHSIA_external_memory)
+	VOLK_LAZY_GLOBAL(vkGetMemoryZirconHandleFUCHSIA, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetMemoryZirconHandlePropertiesFUCHSIA, LazyDevice);
+#endif /* defined(VK_FUCHSIA_external_memory) */
+#if defined(VK_FUCHSIA_external_semaphore)
+	VOLK_LAZY_GLOBAL(vkGetSemaphoreZirconHandleFUCHSIA, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkImportSemaphoreZirconHandleFUCHSIA, LazyDevice);
+#endif /* defined(VK_FUCHSIA_external_semaphore) */
+#if defined(VK_GOOGLE_display_timing)
+	VOLK_LAZY_GLOBAL(vkGetPastPresentationTimingGOOGLE, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetRefreshCycleDurationGOOGLE, LazyDevice);
+#endif /* defined(VK_GOOGLE_display_timing) */
+#if defined(VK_HUAWEI_invocation_mask)
+	VOLK_LAZY_GLOBAL(vkCmdBindInvocationMaskHUAWEI, LazyDevice);
+#endif /* defined(VK_HUAWEI_invocation_mask) */
+#if defined(VK_HUAWEI_subpass_shading)
+	VOLK_LAZY_GLOBAL(vkCmdSubpassShadingHUAWEI, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI, LazyDevice);
+#endif /* defined(VK_HUAWEI_subpass_shading) */
+#if defined(VK_INTEL_performance_query)
+	VOLK_LAZY_GLOBAL(vkAcquirePerformanceConfigurationINTEL, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetPerformanceMarkerINTEL, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetPerformanceOverrideINTEL, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetPerformanceStreamMarkerINTEL, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetPerformanceParameterINTEL, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkInitializePerformanceApiINTEL, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkQueueSetPerformanceConfigurationINTEL, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkReleasePerformanceConfigurationINTEL, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkUninitializePerformanceApiINTEL, LazyDevice);
+#endif /* defined(VK_INTEL_performance_query) */
+#if defined(VK_KHR_acceleration_structure)
+	VOLK_LAZY_GLOBAL(vkBuildAccelerationStructuresKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBuildAccelerationStructuresIndirectKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBuildAccelerationStructuresKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyAccelerationStructureKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyAccelerationStructureToMemoryKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyMemoryToAccelerationStructureKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdWriteAccelerationStructuresPropertiesKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCopyAccelerationStructureKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCopyAccelerationStructureToMemoryKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCopyMemoryToAccelerationStructureKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateAccelerationStructureKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyAccelerationStructureKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetAccelerationStructureBuildSizesKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetAccelerationStructureDeviceAddressKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceAccelerationStructureCompatibilityKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkWriteAccelerationStructuresPropertiesKHR, LazyDevice);
+#endif /* defined(VK_KHR_acceleration_structure) */
+#if defined(VK_KHR_bind_memory2)
+	VOLK_LAZY_GLOBAL(vkBindBufferMemory2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkBindImageMemory2KHR, LazyDevice);
+#endif /* defined(VK_KHR_bind_memory2) */
+#if defined(VK_KHR_buffer_device_address)
+	VOLK_LAZY_GLOBAL(vkGetBufferDeviceAddressKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetBufferOpaqueCaptureAddressKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceMemoryOpaqueCaptureAddressKHR, LazyDevice);
+#endif /* defined(VK_KHR_buffer_device_address) */
+#if defined(VK_KHR_copy_commands2)
+	VOLK_LAZY_GLOBAL(vkCmdBlitImage2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyBuffer2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyBufferToImage2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyImage2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyImageToBuffer2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdResolveImage2KHR, LazyDevice);
+#endif /* defined(VK_KHR_copy_commands2) */
+#if defined(VK_KHR_create_renderpass2)
+	VOLK_LAZY_GLOBAL(vkCmdBeginRenderPass2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdEndRenderPass2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdNextSubpass2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateRenderPass2KHR, LazyDevice);
+#endif /* defined(VK_KHR_create_renderpass2) */
+#if defined(VK_KHR_deferred_host_operations)
+	VOLK_LAZY_GLOBAL(vkCreateDeferredOperationKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDeferredOperationJoinKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyDeferredOperationKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeferredOperationMaxConcurrencyKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeferredOperationResultKHR, LazyDevice);
+#endif /* defined(VK_KHR_deferred_host_operations) */
+#if defined(VK_KHR_descriptor_update_template)
+	VOLK_LAZY_GLOBAL(vkCreateDescriptorUpdateTemplateKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyDescriptorUpdateTemplateKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkUpdateDescriptorSetWithTemplateKHR, LazyDevice);
+#endif /* defined(VK_KHR_descriptor_update_template) */
+#if defined(VK_KHR_device_group)
+	VOLK_LAZY_GLOBAL(vkCmdDispatchBaseKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetDeviceMaskKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceGroupPeerMemoryFeaturesKHR, LazyDevice);
+#endif /* defined(VK_KHR_device_group) */
+#if defined(VK_KHR_display_swapchain)
+	VOLK_LAZY_GLOBAL(vkCreateSharedSwapchainsKHR, LazyDevice);
+#endif /* defined(VK_KHR_display_swapchain) */
+#if defined(VK_KHR_draw_indirect_count)
+	VOLK_LAZY_GLOBAL(vkCmdDrawIndexedIndirectCountKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDrawIndirectCountKHR, LazyDevice);
+#endif /* defined(VK_KHR_draw_indirect_count) */
+#if defined(VK_KHR_dynamic_rendering)
+	VOLK_LAZY_GLOBAL(vkCmdBeginRenderingKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdEndRenderingKHR, LazyDevice);
+#endif /* defined(VK_KHR_dynamic_rendering) */
+#if defined(VK_KHR_external_fence_fd)
+	VOLK_LAZY_GLOBAL(vkGetFenceFdKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkImportFenceFdKHR, LazyDevice);
+#endif /* defined(VK_KHR_external_fence_fd) */
+#if defined(VK_KHR_external_fence_win32)
+	VOLK_LAZY_GLOBAL(vkGetFenceWin32HandleKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkImportFenceWin32HandleKHR, LazyDevice);
+#endif /* defined(VK_KHR_external_fence_win32) */
+#if defined(VK_KHR_external_memory_fd)
+	VOLK_LAZY_GLOBAL(vkGetMemoryFdKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetMemoryFdPropertiesKHR, LazyDevice);
+#endif /* defined(VK_KHR_external_memory_fd) */
+#if defined(VK_KHR_external_memory_win32)
+	VOLK_LAZY_GLOBAL(vkGetMemoryWin32HandleKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetMemoryWin32HandlePropertiesKHR, LazyDevice);
+#endif /* defined(VK_KHR_external_memory_win32) */
+#if defined(VK_KHR_external_semaphore_fd)
+	VOLK_LAZY_GLOBAL(vkGetSemaphoreFdKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkImportSemaphoreFdKHR, LazyDevice);
+#endif /* defined(VK_KHR_external_semaphore_fd) */
+#if defined(VK_KHR_external_semaphore_win32)
+	VOLK_LAZY_GLOBAL(vkGetSemaphoreWin32HandleKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkImportSemaphoreWin32HandleKHR, LazyDevice);
+#endif /* defined(VK_KHR_external_semaphore_win32) */
+#if defined(VK_KHR_fragment_shading_rate)
+	VOLK_LAZY_GLOBAL(vkCmdSetFragmentShadingRateKHR, LazyDevice);
+#endif /* defined(VK_KHR_fragment_shading_rate) */
+#if defined(VK_KHR_get_memory_requirements2)
+	VOLK_LAZY_GLOBAL(vkGetBufferMemoryRequirements2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetImageMemoryRequirements2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetImageSparseMemoryRequirements2KHR, LazyDevice);
+#endif /* defined(VK_KHR_get_memory_requirements2) */
+#if defined(VK_KHR_maintenance1)
+	VOLK_LAZY_GLOBAL(vkTrimCommandPoolKHR, LazyDevice);
+#endif /* defined(VK_KHR_maintenance1) */
+#if defined(VK_KHR_maintenance3)
+	VOLK_LAZY_GLOBAL(vkGetDescriptorSetLayoutSupportKHR, LazyDevice);
+#endif /* defined(VK_KHR_maintenance3) */
+#if defined(VK_KHR_maintenance4)
+	VOLK_LAZY_GLOBAL(vkGetDeviceBufferMemoryRequirementsKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceImageMemoryRequirementsKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceImageSparseMemoryRequirementsKHR, LazyDevice);
+#endif /* defined(VK_KHR_maintenance4) */
+#if defined(VK_KHR_performance_query)
+	VOLK_LAZY_GLOBAL(vkAcquireProfilingLockKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkReleaseProfilingLockKHR, LazyDevice);
+#endif /* defined(VK_KHR_performance_query) */
+#if defined(VK_KHR_pipeline_executable_properties)
+	VOLK_LAZY_GLOBAL(vkGetPipelineExecutableInternalRepresentationsKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetPipelineExecutablePropertiesKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetPipelineExecutableStatisticsKHR, LazyDevice);
+#endif /* defined(VK_KHR_pipeline_executable_properties) */
+#if defined(VK_KHR_present_wait)
+	VOLK_LAZY_GLOBAL(vkWaitForPresentKHR, LazyDevice);
+#endif /* defined(VK_KHR_present_wait) */
+#if defined(VK_KHR_push_descriptor)
+	VOLK_LAZY_GLOBAL(vkCmdPushDescriptorSetKHR, LazyDevice);
+#endif /* defined(VK_KHR_push_descriptor) */
+#if defined(VK_KHR_ray_tracing_pipeline)
+	VOLK_LAZY_GLOBAL(vkCmdSetRayTracingPipelineStackSizeKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdTraceRaysIndirectKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdTraceRaysKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateRayTracingPipelinesKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetRayTracingCaptureReplayShaderGroupHandlesKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetRayTracingShaderGroupHandlesKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetRayTracingShaderGroupStackSizeKHR, LazyDevice);
+#endif /* defined(VK_KHR_ray_tracing_pipeline) */
+#if defined(VK_KHR_sampler_ycbcr_conversion)
+	VOLK_LAZY_GLOBAL(vkCreateSamplerYcbcrConversionKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroySamplerYcbcrConversionKHR, LazyDevice);
+#endif /* defined(VK_KHR_sampler_ycbcr_conversion) */
+#if defined(VK_KHR_shared_presentable_image)
+	VOLK_LAZY_GLOBAL(vkGetSwapchainStatusKHR, LazyDevice);
+#endif /* defined(VK_KHR_shared_presentable_image) */
+#if defined(VK_KHR_swapchain)
+	VOLK_LAZY_GLOBAL(vkAcquireNextImageKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateSwapchainKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroySwapchainKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetSwapchainImagesKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkQueuePresentKHR, LazyDevice);
+#endif /* defined(VK_KHR_swapchain) */
+#if defined(VK_KHR_synchronization2)
+	VOLK_LAZY_GLOBAL(vkCmdPipelineBarrier2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdResetEvent2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetEvent2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdWaitEvents2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdWriteTimestamp2KHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkQueueSubmit2KHR, LazyDevice);
+#endif /* defined(VK_KHR_synchronization2) */
+#if defined(VK_KHR_synchronization2) && defined(VK_AMD_buffer_marker)
+	VOLK_LAZY_GLOBAL(vkCmdWriteBufferMarker2AMD, LazyDevice);
+#endif /* defined(VK_KHR_synchronization2) && defined(VK_AMD_buffer_marker) */
+#if defined(VK_KHR_synchronization2) && defined(VK_NV_device_diagnostic_checkpoints)
+	VOLK_LAZY_GLOBAL(vkGetQueueCheckpointData2NV, LazyDevice);
+#endif /* defined(VK_KHR_synchronization2) && defined(VK_NV_device_diagnostic_checkpoints) */
+#if defined(VK_KHR_timeline_semaphore)
+	VOLK_LAZY_GLOBAL(vkGetSemaphoreCounterValueKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkSignalSemaphoreKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkWaitSemaphoresKHR, LazyDevice);
+#endif /* defined(VK_KHR_timeline_semaphore) */
+#if defined(VK_KHR_video_decode_queue)
+	VOLK_LAZY_GLOBAL(vkCmdDecodeVideoKHR, LazyDevice);
+#endif /* defined(VK_KHR_video_decode_queue) */
+#if defined(VK_KHR_video_encode_queue)
+	VOLK_LAZY_GLOBAL(vkCmdEncodeVideoKHR, LazyDevice);
+#endif /* defined(VK_KHR_video_encode_queue) */
+#if defined(VK_KHR_video_queue)
+	VOLK_LAZY_GLOBAL(vkBindVideoSessionMemoryKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBeginVideoCodingKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdControlVideoCodingKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdEndVideoCodingKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateVideoSessionKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateVideoSessionParametersKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyVideoSessionKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyVideoSessionParametersKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetVideoSessionMemoryRequirementsKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkUpdateVideoSessionParametersKHR, LazyDevice);
+#endif /* defined(VK_KHR_video_queue) */
+#if defined(VK_NVX_binary_import)
+	VOLK_LAZY_GLOBAL(vkCmdCuLaunchKernelNVX, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateCuFunctionNVX, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateCuModuleNVX, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyCuFunctionNVX, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyCuModuleNVX, LazyDevice);
+#endif /* defined(VK_NVX_binary_import) */
+#if defined(VK_NVX_image_view_handle)
+	VOLK_LAZY_GLOBAL(vkGetImageViewAddressNVX, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetImageViewHandleNVX, LazyDevice);
+#endif /* defined(VK_NVX_image_view_handle) */
+#if defined(VK_NV_clip_space_w_scaling)
+	VOLK_LAZY_GLOBAL(vkCmdSetViewportWScalingNV, LazyDevice);
+#endif /* defined(VK_NV_clip_space_w_scaling) */
+#if defined(VK_NV_device_diagnostic_checkpoints)
+	VOLK_LAZY_GLOBAL(vkCmdSetCheckpointNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetQueueCheckpointDataNV, LazyDevice);
+#endif /* defined(VK_NV_device_diagnostic_checkpoints) */
+#if defined(VK_NV_device_generated_commands)
+	VOLK_LAZY_GLOBAL(vkCmdBindPipelineShaderGroupNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdExecuteGeneratedCommandsNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdPreprocessGeneratedCommandsNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateIndirectCommandsLayoutNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyIndirectCommandsLayoutNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetGeneratedCommandsMemoryRequirementsNV, LazyDevice);
+#endif /* defined(VK_NV_device_generated_commands) */
+#if defined(VK_NV_external_memory_rdma)
+	VOLK_LAZY_GLOBAL(vkGetMemoryRemoteAddressNV, LazyDevice);
+#endif /* defined(VK_NV_external_memory_rdma) */
+#if defined(VK_NV_external_memory_win32)
+	VOLK_LAZY_GLOBAL(vkGetMemoryWin32HandleNV, LazyDevice);
+#endif /* defined(VK_NV_external_memory_win32) */
+#if defined(VK_NV_fragment_shading_rate_enums)
+	VOLK_LAZY_GLOBAL(vkCmdSetFragmentShadingRateEnumNV, LazyDevice);
+#endif /* defined(VK_NV_fragment_shading_rate_enums) */
+#if defined(VK_NV_mesh_shader)
+	VOLK_LAZY_GLOBAL(vkCmdDrawMeshTasksIndirectCountNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDrawMeshTasksIndirectNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdDrawMeshTasksNV, LazyDevice);
+#endif /* defined(VK_NV_mesh_shader) */
+#if defined(VK_NV_ray_tracing)
+	VOLK_LAZY_GLOBAL(vkBindAccelerationStructureMemoryNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdBuildAccelerationStructureNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdCopyAccelerationStructureNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdTraceRaysNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdWriteAccelerationStructuresPropertiesNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCompileDeferredNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateAccelerationStructureNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCreateRayTracingPipelinesNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkDestroyAccelerationStructureNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetAccelerationStructureHandleNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetAccelerationStructureMemoryRequirementsNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetRayTracingShaderGroupHandlesNV, LazyDevice);
+#endif /* defined(VK_NV_ray_tracing) */
+#if defined(VK_NV_scissor_exclusive)
+	VOLK_LAZY_GLOBAL(vkCmdSetExclusiveScissorNV, LazyDevice);
+#endif /* defined(VK_NV_scissor_exclusive) */
+#if defined(VK_NV_shading_rate_image)
+	VOLK_LAZY_GLOBAL(vkCmdBindShadingRateImageNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetCoarseSampleOrderNV, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkCmdSetViewportShadingRatePaletteNV, LazyDevice);
+#endif /* defined(VK_NV_shading_rate_image) */
+#if defined(VK_VALVE_descriptor_set_host_mapping)
+	VOLK_LAZY_GLOBAL(vkGetDescriptorSetHostMappingVALVE, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDescriptorSetLayoutHostMappingInfoVALVE, LazyDevice);
+#endif /* defined(VK_VALVE_descriptor_set_host_mapping) */
+#if (defined(VK_EXT_full_screen_exclusive) && defined(VK_KHR_device_group)) || (defined(VK_EXT_full_screen_exclusive) && defined(VK_VERSION_1_1))
+	VOLK_LAZY_GLOBAL(vkGetDeviceGroupSurfacePresentModes2EXT, LazyDevice);
+#endif /* (defined(VK_EXT_full_screen_exclusive) && defined(VK_KHR_device_group)) || (defined(VK_EXT_full_screen_exclusive) && defined(VK_VERSION_1_1)) */
+#if (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor)) || (defined(VK_KHR_push_descriptor) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_push_descriptor) && defined(VK_KHR_descriptor_update_template))
+	VOLK_LAZY_GLOBAL(vkCmdPushDescriptorSetWithTemplateKHR, LazyDevice);
+#endif /* (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor)) || (defined(VK_KHR_push_descriptor) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_push_descriptor) && defined(VK_KHR_descriptor_update_template)) */
+#if (defined(VK_KHR_device_group) && defined(VK_KHR_surface)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1))
+	VOLK_LAZY_GLOBAL(vkGetDeviceGroupPresentCapabilitiesKHR, LazyDevice);
+	VOLK_LAZY_GLOBAL(vkGetDeviceGroupSurfacePresentModesKHR, LazyDevice);
+#endif /* (defined(VK_KHR_device_group) && defined(VK_KHR_surface)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) */
+#if (defined(VK_KHR_device_group) && defined(VK_KHR_swapchain)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1))
+	VOLK_LAZY_GLOBAL(vkAcquireNextImage2KHR, LazyDevice);
+#endif /* (defined(VK_KHR_device_group) && defined(VK_KHR_swapchain)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) */
+	/* VOLK_GENERATE_LAZY_DEVICE */
+}
+
+static void volkGenLoadDeviceTableLazy(struct VolkDeviceTable* table)
+{
+	/* VOLK_GENERATE_LAZY_DEVICE_TABLE */
+#if defined(VK_VERSION_1_0)
+	VOLK_LAZY_TABLE(vkAllocateCommandBuffers);
+	VOLK_LAZY_TABLE(vkAllocateDescriptorSets);
+	VOLK_LAZY_TABLE(vkAllocateMemory);
+	VOLK_LAZY_TABLE(vkBeginCommandBuffer);
+	VOLK_LAZY_TABLE(vkBindBufferMemory);
+	VOLK_LAZY_TABLE(vkBindImageMemory);
+	VOLK_LAZY_TABLE(vkCmdBeginQuery);
+	VOLK_LAZY_TABLE(vkCmdBeginRenderPass);
+	VOLK_LAZY_TABLE(vkCmdBindDescriptorSets);
+	VOLK_LAZY_TABLE(vkCmdBindIndexBuffer);
+	VOLK_LAZY_TABLE(vkCmdBindPipeline);
+	VOLK_LAZY_TABLE(vkCmdBindVertexBuffers);
+	VOLK_LAZY_TABLE(vkCmdBlitImage);
+	VOLK_LAZY_TABLE(vkCmdClearAttachments);
+	VOLK_LAZY_TABLE(vkCmdClearColorImage);
+	VOLK_LAZY_TABLE(vkCmdClearDepthStencilImage);
+	VOLK_LAZY_TABLE(vkCmdCopyBuffer);
+	VOLK_LAZY_TABLE(vkCmdCopyBufferToImage);
+	VOLK_LAZY_TABLE(vkCmdCopyImage);
+	VOLK_LAZY_TABLE(vkCmdCopyImageToBuffer);
+	VOLK_LAZY_TABLE(vkCmdCopyQueryPoolResults);
+	VOLK_LAZY_TABLE(vkCmdDispatch);
+	VOLK_LAZY_TABLE(vkCmdDispatchIndirect);
+	VOLK_LAZY_TABLE(vkCmdDraw);
+	VOLK_LAZY_TABLE(vkCmdDrawIndexed);
+	VOLK_LAZY_TABLE(vkCmdDrawIndexedIndirect);
+	VOLK_LAZY_TABLE(vkCmdDrawIndirect);
+	VOLK_LAZY_TABLE(vkCmdEndQuery);
+	VOLK_LAZY_TABLE(vkCmdEndRenderPass);
+	VOLK_LAZY_TABLE(vkCmdExecuteCommands);
+	VOLK_LAZY_TABLE(vkCmdFillBuffer);
+	VOLK_LAZY_TABLE(vkCmdNextSubpass);
+	VOLK_LAZY_TABLE(vkCmdPipelineBarrier);
+	VOLK_LAZY_TABLE(vkCmdPushConstants);
+	VOLK_LAZY_TABLE(vkCmdResetEvent);
+	VOLK_LAZY_TABLE(vkCmdResetQueryPool);
+	VOLK_LAZY_TABLE(vkCmdResolveImage);
+	VOLK_LAZY_TABLE(vkCmdSetBlendConstants);
+	VOLK_LAZY_TABLE(vkCmdSetDepthBias);
+	VOLK_LAZY_TABLE(vkCmdSetDepthBounds);
+	VOLK_LAZY_TABLE(vkCmdSetEvent);
+	VOLK_LAZY_TABLE(vkCmdSetLineWidth);
+	VOLK_LAZY_TABLE(vkCmdSetScissor);
+	VOLK_LAZY_TABLE(vkCmdSetStencilCompareMask);
+	VOLK_LAZY_TABLE(vkCmdSetStencilReference);
+	VOLK_LAZY_TABLE(vkCmdSetStencilWriteMask);
+	VOLK_LAZY_TABLE(vkCmdSetViewport);
+	VOLK_LAZY_TABLE(vkCmdUpdateBuffer);
+	VOLK_LAZY_TABLE(vkCmdWaitEvents);
+	VOLK_LAZY_TABLE(vkCmdWriteTimestamp);
+	VOLK_LAZY_TABLE(vkCreateBuffer);
+	VOLK_LAZY_TABLE(vkCreateBufferView);
+	VOLK_LAZY_TABLE(vkCreateCommandPool);
+	VOLK_LAZY_TABLE(vkCreateComputePipelines);
+	VOLK_LAZY_TABLE(vkCreateDescriptorPool);
+	VOLK_LAZY_TABLE(vkCreateDescriptorSetLayout);
+	VOLK_LAZY_TABLE(vkCreateEvent);
+	VOLK_LAZY_TABLE(vkCreateFence);
+	VOLK_LAZY_TABLE(vkCreateFramebuffer);
+	VOLK_LAZY_TABLE(vkCreateGraphicsPipelines);
+	VOLK_LAZY_TABLE(vkCreateImage);
+	VOLK_LAZY_TABLE(vkCreateImageView);
+	VOLK_LAZY_TABLE(vkCreatePipelineCache);
+	VOLK_LAZY_TABLE(vkCreatePipelineLayout);
+	VOLK_LAZY_TABLE(vkCreateQueryPool);
+	VOLK_LAZY_TABLE(vkCreateRenderPass);
+	VOLK_LAZY_TABLE(vkCreateSampler);
+	VOLK_LAZY_TABLE(vkCreateSemaphore);
+	VOLK_LAZY_TABLE(vkCreateShaderModule);
+	VOLK_LAZY_TABLE(vkDestroyBuffer);
+	VOLK_LAZY_TABLE(vkDestroyBufferView);
+	VOLK_LAZY_TABLE(vkDestroyCommandPool);
+	VOLK_LAZY_TABLE(vkDestroyDescriptorPool);
+	VOLK_LAZY_TABLE(vkDestroyDescriptorSetLayout);
+	VOLK_LAZY_TABLE(vkDestroyDevice);
+	VOLK_LAZY_TABLE(vkDestroyEvent);
+	VOLK_LAZY_TABLE(vkDestroyFence);
+	VOLK_LAZY_TABLE(vkDestroyFramebuffer);
+	VOLK_LAZY_TABLE(vkDestroyImage);
+	VOLK_LAZY_TABLE(vkDestroyImageView);
+	VOLK_LAZY_TABLE(vkDestroyPipeline);
+	VOLK_LAZY_TABLE(vkDestroyPipelineCache);
+	VOLK_LAZY_TABLE(vkDestroyPipelineLayout);
+	VOLK_LAZY_TABLE(vkDestroyQueryPool);
+	VOLK_LAZY_TABLE(vkDestroyRenderPass);
+	VOLK_LAZY_TABLE(vkDestroySampler);
+	VOLK_LAZY_TABLE(vkDestroySemaphore);
+	VOLK_LAZY_TABLE(vkDestroyShaderModule);
+	VOLK_LAZY_TABLE(vkDeviceWaitIdle);
+	VOLK_LAZY_TABLE(vkEndCommandBuffer);
+	VOLK_LAZY_TABLE(vkFlushMappedMemoryRanges);
+	VOLK_LAZY_TABLE(vkFreeCommandBuffers);
+	VOLK_LAZY_TABLE(vkFreeDescriptorSets);
+	VOLK_LAZY_TABLE(vkFreeMemory);
+	VOLK_LAZY_TABLE(vkGetBufferMemoryRequirements);
+	VOLK_LAZY_TABLE(vkGetDeviceMemoryCommitment);
+	VOLK_LAZY_TABLE(vkGetDeviceQueue);
+	VOLK_LAZY_TABLE(vkGetEventStatus);
+	VOLK_LAZY_TABLE(vkGetFenceStatus);
+	VOLK_LAZY_TABLE(vkGetImageMemoryRequirements);
+	VOLK_LAZY_TABLE(vkGetImageSparseMemoryRequirements);
+	VOLK_LAZY_TABLE(vkGetImageSubresourceLayout);
+	VOLK_LAZY_TABLE(vkGetPipelineCacheData);
+	VOLK_LAZY_TABLE(vkGetQueryPoolResults);
+	VOLK_LAZY_TABLE(vkGetRenderAreaGranularity);
+	VOLK_LAZY_TABLE(vkInvalidateMappedMemoryRanges);
+	VOLK_LAZY_TABLE(vkMapMemory);
+	VOLK_LAZY_TABLE(vkMergePipelineCaches);
+	VOLK_LAZY_TABLE(vkQueueBindSparse);
+	VOLK_LAZY_TABLE(vkQueueSubmit);
+	VOLK_LAZY_TABLE(vkQueueWaitIdle);
+	VOLK_LAZY_TABLE(vkResetCommandBuffer);
+	VOLK_LAZY_TABLE(vkResetCommandPool);
+	VOLK_LAZY_TABLE(vkResetDescriptorPool);
+	VOLK_LAZY_TABLE(vkResetEvent);
+	VOLK_LAZY_TABLE(vkResetFences);
+	VOLK_LAZY_TABLE(vkSetEvent);
+	VOLK_LAZY_TABLE(vkUnmapMemory);
+	VOLK_LAZY_TABLE(vkUpdateDescriptorSets);
+	VOLK_LAZY_TABLE(vkWaitForFences);
+#endif /* defined(VK_VERSION_1_0) */
+#if defined(VK_VERSION_1_1)
+	VOLK_LAZY_TABLE(vkBindBufferMemory2);
+	VOLK_LAZY_TABLE(vkBindImageMemory2);
+	VOLK_LAZY_TABLE(vkCmdDispatchBase);
+	VOLK_LAZY_TABLE(vkCmdSetDeviceMask);
+	VOLK_LAZY_TABLE(vkCreateDescriptorUpdateTemplate);
+	VOLK_LAZY_TABLE(vkCreateSamplerYcbcrConversion);
+	VOLK_LAZY_TABLE(vkDestroyDescriptorUpdateTemplate);
+	VOLK_LAZY_TABLE(vkDestroySamplerYcbcrConversion);
+	VOLK_LAZY_TABLE(vkGetBufferMemoryRequirements2);
+	VOLK_LAZY_TABLE(vkGetDescriptorSetLayoutSupport);
+	VOLK_LAZY_TABLE(vkGetDeviceGroupPeerMemoryFeatures);
+	VOLK_LAZY_TABLE(vkGetDeviceQueue2);
+	VOLK_LAZY_TABLE(vkGetImageMemoryRequirements2);
+	VOLK_LAZY_TABLE(vkGetImageSparseMemoryRequirements2);
+	VOLK_LAZY_TABLE(vkTrimCommandPool);
+	VOLK_LAZY_TABLE(vkUpdateDescriptorSetWithTemplate);
+#endif /* defined(VK_VERSION_1_1) */
+#if defined(VK_VERSION_1_2)
+	VOLK_LAZY_TABLE(vkCmdBeginRenderPass2);
+	VOLK_LAZY_TABLE(vkCmdDrawIndexedIndirectCount);
+	VOLK_LAZY_TABLE(vkCmdDrawIndirectCount);
+	VOLK_LAZY_TABLE(vkCmdEndRenderPass2);
+	VOLK_LAZY_TABLE(vkCmdNextSubpass2);
+	VOLK_LAZY_TABLE(vkCreateRenderPass2);
+	VOLK_LAZY_TABLE(vkGetBufferDeviceAddress);
+	VOLK_LAZY_TABLE(vkGetBufferOpaqueCaptureAddress);
+	VOLK_LAZY_TABLE(vkGetDeviceMemoryOpaqueCaptureAddress);
+	VOLK_LAZY_TABLE(vkGetSemaphoreCounterValue);
+	VOLK_LAZY_TABLE(vkResetQueryPool);
+	VOLK_LAZY_TABLE(vkSignalSemaphore);
+	VOLK_LAZY_TABLE(vkWaitSemaphores);
+#endif /* defined(VK_VERSION_1_2) */
+#if defined(VK_VERSION_1_3)
+	VOLK_LAZY_TABLE(vkCmdBeginRendering);
+	VOLK_LAZY_TABLE(vkCmdBindVertexBuffers2);
+	VOLK_LAZY_TABLE(vkCmdBlitImage2);
+	VOLK_LAZY_TABLE(vkCmdCopyBuffer2);
+	VOLK_LAZY_TABLE(vkCmdCopyBufferToImage2);
+	VOLK_LAZY_TABLE(vkCmdCopyImage2);
+	VOLK_LAZY_TABLE(vkCmdCopyImageToBuffer2);
+	VOLK_LAZY_TABLE(vkCmdEndRendering);
+	VOLK_LAZY_TABLE(vkCmdPipelineBarrier2);
+	VOLK_LAZY_TABLE(vkCmdResetEvent2);
+	VOLK_LAZY_TABLE(vkCmdResolveImage2);
+	VOLK_LAZY_TABLE(vkCmdSetCullMode);
+	VOLK_LAZY_TABLE(vkCmdSetDepthBiasEnable);
+	VOLK_LAZY_TABLE(vkCmdSetDepthBoundsTestEnable);
+	VOLK_LAZY_TABLE(vkCmdSetDepthCompareOp);
+	VOLK_LAZY_TABLE(vkCmdSetDepthTestEnable);
+	VOLK_LAZY_TABLE(vkCmdSetDepthWriteEnable);
+	VOLK_LAZY_TABLE(vkCmdSetEvent2);
+	VOLK_LAZY_TABLE(vkCmdSetFrontFace);
+	VOLK_LAZY_TABLE(vkCmdSetPrimitiveRestartEnable);
+	VOLK_LAZY_TABLE(vkCmdSetPrimitiveTopology);
+	VOLK_LAZY_TABLE(vkCmdSetRasterizerDiscardEnable);
+	VOLK_LAZY_TABLE(vkCmdSetScissorWithCount);
+	VOLK_LAZY_TABLE(vkCmdSetStencilOp);
+	VOLK_LAZY_TABLE(vkCmdSetStencilTestEnable);
+	VOLK_LAZY_TABLE(vkCmdSetViewportWithCount);
+	VOLK_LAZY_TABLE(vkCmdWaitEvents2);
+	VOLK_LAZY_TABLE(vkCmdWriteTimestamp2);
+	VOLK_LAZY_TABLE(vkCreatePrivateDataSlot);
+	VOLK_LAZY_TABLE(vkDestroyPrivateDataSlot);
+	VOLK_LAZY_TABLE(vkGetDeviceBufferMemoryRequirements);
+	VOLK_LAZY_TABLE(vkGetDeviceImageMemoryRequirements);
+	VOLK_LAZY_TABLE(vkGetDeviceImageSparseMemoryRequirements);
+	VOLK_LAZY_TABLE(vkGetPrivateData);
+	VOLK_LAZY_TABLE(vkQueueSubmit2);
+	VOLK_LAZY_TABLE(vkSetPrivateData);
+#endif /* defined(VK_VERSION_1_3) */
+#if defined(VK_AMD_buffer_marker)
+	VOLK_LAZY_TABLE(vkCmdWriteBufferMarkerAMD);
+#endif /* defined(VK_AMD_buffer_marker) */
+#if defined(VK_AMD_display_native_hdr)
+	VOLK_LAZY_TABLE(vkSetLocalDimmingAMD);
+#endif /* defined(VK_AMD_display_native_hdr) */
+#if defined(VK_AMD_draw_indirect_count)
+	VOLK_LAZY_TABLE(vkCmdDrawIndexedIndirectCountAMD);
+	VOLK_LAZY_TABLE(vkCmdDrawIndirectCountAMD);
+#endif /* defined(VK_AMD_draw_indirect_count) */
+#if defined(VK_AMD_shader_info)
+	VOLK_LAZY_TABLE(vkGetShaderInfoAMD);
+#endif /* defined(VK_AMD_shader_info) */
+#if defined(VK_ANDROID_external_memory_android_hardware_buffer)
+	VOLK_LAZY_TABLE(vkGetAndroidHardwareBufferPropertiesANDROID);
+	VOLK_LAZY_TABLE(vkGetMemoryAndroidHardwareBufferANDROID);
+#endif /* defined(VK_ANDROID_external_memory_android_hardware_buffer) */
+#if defined(VK_EXT_buffer_device_address)
+	VOLK_LAZY_TABLE(vkGetBufferDeviceAddressEXT);
+#endif /* defined(VK_EXT_buffer_device_address) */
+#if defined(VK_EXT_calibrated_timestamps)
+	VOLK_LAZY_TABLE(vkGetCalibratedTimestampsEXT);
+#endif /* defined(VK_EXT_calibrated_timestamps) */
+#if defined(VK_EXT_color_write_enable)
+	VOLK_LAZY_TABLE(vkCmdSetColorWriteEnableEXT);
+#endif /* defined(VK_EXT_color_write_enable) */
+#if defined(VK_EXT_conditional_rendering)
+	VOLK_LAZY_TABLE(vkCmdBeginConditionalRenderingEXT);
+	VOLK_LAZY_TABLE(vkCmdEndConditionalRenderingEXT);
+#endif /* defined(VK_EXT_conditional_rendering) */
+#if defined(VK_EXT_debug_marker)
+	VOLK_LAZY_TABLE(vkCmdDebugMarkerBeginEXT);
+	VOLK_LAZY_TABLE(vkCmdDebugMarkerEndEXT);
+	VOLK_LAZY_TABLE(vkCmdDebugMarkerInsertEXT);
+	VOLK_LAZY_TABLE(vkDebugMarkerSetObjectNameEXT);
+	VOLK_LAZY_TABLE(vkDebugMarkerSetObjectTagEXT);
+#endif /* defined(VK_EXT_debug_marker) */
+#if defined(VK_EXT_discard_rectangles)
+	VOLK_LAZY_TABLE(vkCmdSetDiscardRectangleEXT);
+#endif /* defined(VK_EXT_discard_rectangles) */
+#if defined(VK_EXT_display_control)
+	VOLK_LAZY_TABLE(vkDisplayPowerControlEXT);
+	VOLK_LAZY_TABLE(vkGetSwapchainCounterEXT);
+	VOLK_LAZY_TABLE(vkRegisterDeviceEventEXT);
+	VOLK_LAZY_TABLE(vkRegisterDisplayEventEXT);
+#endif /* defined(VK_EXT_display_control) */
+#if defined(VK_EXT_extended_dynamic_state)
+	VOLK_LAZY_TABLE(vkCmdBindVertexBuffers2EXT);
+	VOLK_LAZY_TABLE(vkCmdSetCullModeEXT);
+	VOLK_LAZY_TABLE(vkCmdSetDepthBoundsTestEnableEXT);
+	VOLK_LAZY_TABLE(vkCmdSetDepthCompareOpEXT);
+	VOLK_LAZY_TABLE(vkCmdSetDepthTestEnableEXT);
+	VOLK_LAZY_TABLE(vkCmdSetDepthWriteEnableEXT);
+	VOLK_LAZY_TABLE(vkCmdSetFrontFaceEXT);
+	VOLK_LAZY_TABLE(vkCmdSetPrimitiveTopologyEXT);
+	VOLK_LAZY_TABLE(vkCmdSetScissorWithCountEXT);
+	VOLK_LAZY_TABLE(vkCmdSetStencilOpEXT);
+	VOLK_LAZY_TABLE(vkCmdSetStencilTestEnableEXT);
+	VOLK_LAZY_TABLE(vkCmdSetViewportWithCountEXT);
+#endif /* defined(VK_EXT_extended_dynamic_state) */
+#if defined(VK_EXT_extended_dynamic_state2)
+	VOLK_LAZY_TABLE(vkCmdSetDepthBiasEnableEXT);
+	VOLK_LAZY_TABLE(vkCmdSetLogicOpEXT);
+	VOLK_LAZY_TABLE(vkCmdSetPatchControlPointsEXT);
+	VOLK_LAZY_TABLE(vkCmdSetPrimitiveRestartEnableEXT);
+	VOLK_LAZY_TABLE(vkCmdSetRasterizerDiscardEnableEXT);
+#endif /* defined(VK_EXT_extended_dynamic_state2) */
+#if defined(VK_EXT_external_memory_host)
+	VOLK_LAZY_TABLE(vkGetMemoryHostPointerPropertiesEXT);
+#endif /* defined(VK_EXT_external_memory_host) */
+#if defined(VK_EXT_full_screen_exclusive)
+	VOLK_LAZY_TABLE(vkAcquireFullScreenExclusiveModeEXT);
+	VOLK_LAZY_TABLE(vkReleaseFullScreenExclusiveModeEXT);
+#endif /* defined(VK_EXT_full_screen_exclusive) */
+#if defined(VK_EXT_hdr_metadata)
+	VOLK_LAZY_TABLE(vkSetHdrMetadataEXT);
+#endif /* defined(VK_EXT_hdr_metadata) */
+#if defined(VK_EXT_host_query_reset)
+	VOLK_LAZY_TABLE(vkResetQueryPoolEXT);
+#endif /* defined(VK_EXT_host_query_reset) */
+#if defined(VK_EXT_image_drm_format_modifier)
+	VOLK_LAZY_TABLE(vkGetImageDrmFormatModifierPropertiesEXT);
+#endif /* defined(VK_EXT_image_drm_format_modifier) */
+#if defined(VK_EXT_line_rasterization)
+	VOLK_LAZY_TABLE(vkCmdSetLineStippleEXT);
+#endif /* defined(VK_EXT_line_rasterization) */
+#if defined(VK_EXT_multi_draw)
+	VOLK_LAZY_TABLE(vkCmdDrawMultiEXT);
+	VOLK_LAZY_TABLE(vkCmdDrawMultiIndexedEXT);
+#endif /* defined(VK_EXT_multi_draw) */
+#if defined(VK_EXT_pageable_device_local_memory)
+	VOLK_LAZY_TABLE(vkSetDeviceMemoryPriorityEXT);
+#endif /* defined(VK_EXT_pageable_device_local_memory) */
+#if defined(VK_EXT_private_data)
+	VOLK_LAZY_TABLE(vkCreatePrivateDataSlotEXT);
+	VOLK_LAZY_TABLE(vkDestroyPrivateDataSlotEXT);
+	VOLK_LAZY_TABLE(vkGetPrivateDataEXT);
+	VOLK_LAZY_TABLE(vkSetPrivateDataEXT);
+#endif /* defined(VK_EXT_private_data) */
+#if defined(VK_EXT_sample_locations)
+	VOLK_LAZY_TABLE(vkCmdSetSampleLocationsEXT);
+#endif /* defined(VK_EXT_sample_locations) */
+#if defined(VK_EXT_transform_feedback)
+	VOLK_LAZY_TABLE(vkCmdBeginQueryIndexedEXT);
+	VOLK_LAZY_TABLE(vkCmdBeginTransformFeedbackEXT);
+	VOLK_LAZY_TABLE(vkCmdBindTransformFeedbackBuffersEXT);
+	VOLK_LAZY_TABLE(vkCmdDrawIndirectByteCountEXT);
+	VOLK_LAZY_TABLE(vkCmdEndQueryIndexedEXT);
+	VOLK_LAZY_TABLE(vkCmdEndTransformFeedbackEXT);
+#endif /* defined(VK_EXT_transform_feedback) */
+#if defined(VK_EXT_validation_cache)
+	VOLK_LAZY_TABLE(vkCreateValidationCacheEXT);
+	VOLK_LAZY_TABLE(vkDestroyValidationCacheEXT);
+	VOLK_LAZY_TABLE(vkGetValidationCacheDataEXT);
+	VOLK_LAZY_TABLE(vkMergeValidationCachesEXT);
+#endif /* defined(VK_EXT_validation_cache) */
+#if defined(VK_EXT_vertex_input_dynamic_state)
+	VOLK_LAZY_TABLE(vkCmdSetVertexInputEXT);
+#endif /* defined(VK_EXT_vertex_input_dynamic_state) */
+#if defined(VK_FUCHSIA_buffer_collection)
+	VOLK_LAZY_TABLE(vkCreateBufferCollectionFUCHSIA);
+	VOLK_LAZY_TABLE(vkDestroyBufferCollectionFUCHSIA);
+	VOLK_LAZY_TABLE(vkGetBufferCollectionPropertiesFUCHSIA);
+	VOLK_LAZY_TABLE(vkSetBufferCollectionBufferConstraintsFUCHSIA);
+	VOLK_LAZY_TABLE(vkSetBufferCollectionImageConstraintsFUCHSIA);
+#endif /* defined(VK_FUCHSIA_buffer_collection) */
+#if defined(VK_FUCHSIA_external_memory)
+	VOLK_LAZY_TABLE(vkGetMemoryZirconHandleFUCHSIA);
+	VOLK_LAZY_TABLE(vkGetMemoryZirconHandlePropertiesFUCHSIA);
+#endif /* defined(VK_FUCHSIA_external_memory) */
+#if defined(VK_FUCHSIA_external_semaphore)
+	VOLK_LAZY_TABLE(vkGetSemaphoreZirconHandleFUCHSIA);
+	VOLK_LAZY_TABLE(vkImportSemaphoreZirconHandleFUCHSIA);
+#endif /* defined(VK_FUCHSIA_external_semaphore) */
+#if defined(VK_GOOGLE_display_timing)
+	VOLK_LAZY_TABLE(vkGetPastPresentationTimingGOOGLE);
+	VOLK_LAZY_TABLE(vkGetRefreshCycleDurationGOOGLE);
+#endif /* defined(VK_GOOGLE_display_timing) */
+#if defined(VK_HUAWEI_invocation_mask)
+	VOLK_LAZY_TABLE(vkCmdBindInvocationMaskHUAWEI);
+#endif /* defined(VK_HUAWEI_invocation_mask) */
+#if defined(VK_HUAWEI_subpass_shading)
+	VOLK_LAZY_TABLE(vkCmdSubpassShadingHUAWEI);
+	VOLK_LAZY_TABLE(vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI);
+#endif /* defined(VK_HUAWEI_subpass_shading) */
+#if defined(VK_INTEL_performance_query)
+	VOLK_LAZY_TABLE(vkAcquirePerformanceConfigurationINTEL);
+	VOLK_LAZY_TABLE(vkCmdSetPerformanceMarkerINTEL);
+	VOLK_LAZY_TABLE(vkCmdSetPerformanceOverrideINTEL);
+	VOLK_LAZY_TABLE(vkCmdSetPerformanceStreamMarkerINTEL);
+	VOLK_LAZY_TABLE(vkGetPerformanceParameterINTEL);
+	VOLK_LAZY_TABLE(vkInitializePerformanceApiINTEL);
+	VOLK_LAZY_TABLE(vkQueueSetPerformanceConfigurationINTEL);
+	VOLK_LAZY_TABLE(vkReleasePerformanceConfigurationINTEL);
+	VOLK_LAZY_TABLE(vkUninitializePerformanceApiINTEL);
+#endif /* defined(VK_INTEL_performance_query) */
+#if defined(VK_KHR_acceleration_structure)
+	VOLK_LAZY_TABLE(vkBuildAccelerationStructuresKHR);
+	VOLK_LAZY_TABLE(vkCmdBuildAccelerationStructuresIndirectKHR);
+	VOLK_LAZY_TABLE(vkCmdBuildAccelerationStructuresKHR);
+	VOLK_LAZY_TABLE(vkCmdCopyAccelerationStructureKHR);
+	VOLK_LAZY_TABLE(vkCmdCopyAccelerationStructureToMemoryKHR);
+	VOLK_LAZY_TABLE(vkCmdCopyMemoryToAccelerationStructureKHR);
+	VOLK_LAZY_TABLE(vkCmdWriteAccelerationStructuresPropertiesKHR);
+	VOLK_LAZY_TABLE(vkCopyAccelerationStructureKHR);
+	VOLK_LAZY_TABLE(vkCopyAccelerationStructureToMemoryKHR);
+	VOLK_LAZY_TABLE(vkCopyMemoryToAccelerationStructureKHR);
+	VOLK_LAZY_TABLE(vkCreateAccelerationStructureKHR);
+	VOLK_LAZY_TABLE(vkDestroyAccelerationStructureKHR);
+	VOLK_LAZY_TABLE(vkGetAccelerationStructureBuildSizesKHR);
+	VOLK_LAZY_TABLE(vkGetAccelerationStructureDeviceAddressKHR);
+	VOLK_LAZY_TABLE(vkGetDeviceAccelerationStructureCompatibilityKHR);
+	VOLK_LAZY_TABLE(vkWriteAccelerationStructuresPropertiesKHR);
+#endif /* defined(VK_KHR_acceleration_structure) */
+#if defined(VK_KHR_bind_memory2)
+	VOLK_LAZY_TABLE(vkBindBufferMemory2KHR);
+	VOLK_LAZY_TABLE(vkBindImageMemory2KHR);
+#endif /* defined(VK_KHR_bind_memory2) */
+#if defined(VK_KHR_buffer_device_address)
+	VOLK_LAZY_TABLE(vkGetBufferDeviceAddressKHR);
+	VOLK_LAZY_TABLE(vkGetBufferOpaqueCaptureAddressKHR);
+	VOLK_LAZY_TABLE(vkGetDeviceMemoryOpaqueCaptureAddressKHR);
+#endif /* defined(VK_KHR_buffer_device_address) */
+#if defined(VK_KHR_copy_commands2)
+	VOLK_LAZY_TABLE(vkCmdBlitImage2KHR);
+	VOLK_LAZY_TABLE(vkCmdCopyBuffer2KHR);
+	VOLK_LAZY_TABLE(vkCmdCopyBufferToImage2KHR);
+	VOLK_LAZY_TABLE(vkCmdCopyImage2KHR);
+	VOLK_LAZY_TABLE(vkCmdCopyImageToBuffer2KHR);
+	VOLK_LAZY_TABLE(vkCmdResolveImage2KHR);
+#endif /* defined(VK_KHR_copy_commands2) */
+#if defined(VK_KHR_create_renderpass2)
+	VOLK_LAZY_TABLE(vkCmdBeginRenderPass2KHR);
+	VOLK_LAZY_TABLE(vkCmdEndRenderPass2KHR);
+	VOLK_LAZY_TABLE(vkCmdNextSubpass2KHR);
+	VOLK_LAZY_TABLE(vkCreateRenderPass2KHR);
+#endif /* defined(VK_KHR_create_renderpass2) */
+#if defined(VK_KHR_deferred_host_operations)
+	VOLK_LAZY_TABLE(vkCreateDeferredOperationKHR);
+	VOLK_LAZY_TABLE(vkDeferredOperationJoinKHR);
+	VOLK_LAZY_TABLE(vkDestroyDeferredOperationKHR);
+	VOLK_LAZY_TABLE(vkGetDeferredOperationMaxConcurrencyKHR);
+	VOLK_LAZY_TABLE(vkGetDeferredOperationResultKHR);
+#endif /* defined(VK_KHR_deferred_host_operations) */
+#if defined(VK_KHR_descriptor_update_template)
+	VOLK_LAZY_TABLE(vkCreateDescriptorUpdateTemplateKHR);
+	VOLK_LAZY_TABLE(vkDestroyDescriptorUpdateTemplateKHR);
+	VOLK_LAZY_TABLE(vkUpdateDescriptorSetWithTemplateKHR);
+#endif /* defined(VK_KHR_descriptor_update_template) */
+#if defined(VK_KHR_device_group)
+	VOLK_LAZY_TABLE(vkCmdDispatchBaseKHR);
+	VOLK_LAZY_TABLE(vkCmdSetDeviceMaskKHR);
+	VOLK_LAZY_TABLE(vkGetDeviceGroupPeerMemoryFeaturesKHR);
+#endif /* defined(VK_KHR_device_group) */
+#if defined(VK_KHR_display_swapchain)
+	VOLK_LAZY_TABLE(vkCreateSharedSwapchainsKHR);
+#endif /* defined(VK_KHR_display_swapchain) */
+#if defined(VK_KHR_draw_indirect_count)
+	VOLK_LAZY_TABLE(vkCmdDrawIndexedIndirectCountKHR);
+	VOLK_LAZY_TABLE(vkCmdDrawIndirectCountKHR);
+#endif /* defined(VK_KHR_draw_indirect_count) */
+#if defined(VK_KHR_dynamic_rendering)
+	VOLK_LAZY_TABLE(vkCmdBeginRenderingKHR);
+	VOLK_LAZY_TABLE(vkCmdEndRenderingKHR);
+#endif /* defined(VK_KHR_dynamic_rendering) */
+#if defined(VK_KHR_external_fence_fd)
+	VOLK_LAZY_TABLE(vkGetFenceFdKHR);
+	VOLK_LAZY_TABLE(vkImportFenceFdKHR);
+#endif /* defined(VK_KHR_external_fence_fd) */
+#if defined(VK_KHR_external_fence_win32)
+	VOLK_LAZY_TABLE(vkGetFenceWin32HandleKHR);
+	VOLK_LAZY_TABLE(vkImportFenceWin32HandleKHR);
+#endif /* defined(VK_KHR_external_fence_win32) */
+#if defined(VK_KHR_external_memory_fd)
+	VOLK_LAZY_TABLE(vkGetMemoryFdKHR);
+	VOLK_LAZY_TABLE(vkGetMemoryFdPropertiesKHR);
+#endif /* defined(VK_KHR_external_memory_fd) */
+#if defined(VK_KHR_external_memory_win32)
+	VOLK_LAZY_TABLE(vkGetMemoryWin32HandleKHR);
+	VOLK_LAZY_TABLE(vkGetMemoryWin32HandlePropertiesKHR);
+#endif /* defined(VK_KHR_external_memory_win32) */
+#if defined(VK_KHR_external_semaphore_fd)
+	VOLK_LAZY_TABLE(vkGetSemaphoreFdKHR);
+	VOLK_LAZY_TABLE(vkImportSemaphoreFdKHR);
+#endif /* defined(VK_KHR_external_semaphore_fd) */
+#if defined(VK_KHR_external_semaphore_win32)
+	VOLK_LAZY_TABLE(vkGetSemaphoreWin32HandleKHR);
+	VOLK_LAZY_TABLE(vkImportSemaphoreWin32HandleKHR);
+#endif /* defined(VK_KHR_external_semaphore_win32) */
+#if defined(VK_KHR_fragment_shading_rate)
+	VOLK_LAZY_TABLE(vkCmdSetFragmentShadingRateKHR);
+#endif /* defined(VK_KHR_fragment_shading_rate) */
+#if defined(VK_KHR_get_memory_requirements2)
+	VOLK_LAZY_TABLE(vkGetBufferMemoryRequirements2KHR);
+	VOLK_LAZY_TABLE(vkGetImageMemoryRequirements2KHR);
+	VOLK_LAZY_TABLE(vkGetImageSparseMemoryRequirements2KHR);
+#endif /* defined(VK_KHR_get_memory_requirements2) */
+#if defined(VK_KHR_maintenance1)
+	VOLK_LAZY_TABLE(vkTrimCommandPoolKHR);
+#endif /* defined(VK_KHR_maintenance1) */
+#if defined(VK_KHR_maintenance3)
+	VOLK_LAZY_TABLE(vkGetDescriptorSetLayoutSupportKHR);
+#endif /* defined(VK_KHR_maintenance3) */
+#if defined(VK_KHR_maintenance4)
+	VOLK_LAZY_TABLE(vkGetDeviceBufferMemoryRequirementsKHR);
+	VOLK_LAZY_TABLE(vkGetDeviceImageMemoryRequirementsKHR);
+	VOLK_LAZY_TABLE(vkGetDeviceImageSparseMemoryRequirementsKHR);
+#endif /* defined(VK_KHR_maintenance4) */
+#if defined(VK_KHR_performance_query)
+	VOLK_LAZY_TABLE(vkAcquireProfilingLockKHR);
+	VOLK_LAZY_TABLE(vkReleaseProfilingLockKHR);
+#endif /* defined(VK_KHR_performance_query) */
+#if defined(VK_KHR_pipeline_executable_properties)
+	VOLK_LAZY_TABLE(vkGetPipelineExecutableInternalRepresentationsKHR);
+	VOLK_LAZY_TABLE(vkGetPipelineExecutablePropertiesKHR);
+	VOLK_LAZY_TABLE(vkGetPipelineExecutableStatisticsKHR);
+#endif /* defined(VK_KHR_pipeline_executable_properties) */
+#if defined(VK_KHR_present_wait)
+	VOLK_LAZY_TABLE(vkWaitForPresentKHR);
+#endif /* defined(VK_KHR_present_wait) */
+#if defined(VK_KHR_push_descriptor)
+	VOLK_LAZY_TABLE(vkCmdPushDescriptorSetKHR);
+#endif /* defined(VK_KHR_push_descriptor) */
+#if defined(VK_KHR_ray_tracing_pipeline)
+	VOLK_LAZY_TABLE(vkCmdSetRayTracingPipelineStackSizeKHR);
+	VOLK_LAZY_TABLE(vkCmdTraceRaysIndirectKHR);
+	VOLK_LAZY_TABLE(vkCmdTraceRaysKHR);
+	VOLK_LAZY_TABLE(vkCreateRayTracingPipelinesKHR);
+	VOLK_LAZY_TABLE(vkGetRayTracingCaptureReplayShaderGroupHandlesKHR);
+	VOLK_LAZY_TABLE(vkGetRayTracingShaderGroupHandlesKHR);
+	VOLK_LAZY_TABLE(vkGetRayTracingShaderGroupStackSizeKHR);
+#endif /* defined(VK_KHR_ray_tracing_pipeline) */
+#if defined(VK_KHR_sampler_ycbcr_conversion)
+	VOLK_LAZY_TABLE(vkCreateSamplerYcbcrConversionKHR);
+	VOLK_LAZY_TABLE(vkDestroySamplerYcbcrConversionKHR);
+#endif /* defined(VK_KHR_sampler_ycbcr_conversion) */
+#if defined(VK_KHR_shared_presentable_image)
+	VOLK_LAZY_TABLE(vkGetSwapchainStatusKHR);
+#endif /* defined(VK_KHR_shared_presentable_image) */
+#if defined(VK_KHR_swapchain)
+	VOLK_LAZY_TABLE(vkAcquireNextImageKHR);
+	VOLK_LAZY_TABLE(vkCreateSwapchainKHR);
+	VOLK_LAZY_TABLE(vkDestroySwapchainKHR);
+	VOLK_LAZY_TABLE(vkGetSwapchainImagesKHR);
+	VOLK_LAZY_TABLE(vkQueuePresentKHR);
+#endif /* defined(VK_KHR_swapchain) */
+#if defined(VK_KHR_synchronization2)
+	VOLK_LAZY_TABLE(vkCmdPipelineBarrier2KHR);
+	VOLK_LAZY_TABLE(vkCmdResetEvent2KHR);
+	VOLK_LAZY_TABLE(vkCmdSetEvent2KHR);
+	VOLK_LAZY_TABLE(vkCmdWaitEvents2KHR);
+	VOLK_LAZY_TABLE(vkCmdWriteTimestamp2KHR);
+	VOLK_LAZY_TABLE(vkQueueSubmit2KHR);
+#endif /* defined(VK_KHR_synchronization2) */
+#if defined(VK_KHR_synchronization2) && defined(VK_AMD_buffer_marker)
+	VOLK_LAZY_TABLE(vkCmdWriteBufferMarker2AMD);
+#endif /* defined(VK_KHR_synchronization2) && defined(VK_AMD_buffer_marker) */
+#if defined(VK_KHR_synchronization2) && defined(VK_NV_device_diagnostic_checkpoints)
+	VOLK_LAZY_TABLE(vkGetQueueCheckpointData2NV);
+#endif /* defined(VK_KHR_synchronization2) && defined(VK_NV_device_diagnostic_checkpoints) */
+#if defined(VK_KHR_timeline_semaphore)
+	VOLK_LAZY_TABLE(vkGetSemaphoreCounterValueKHR);
+	VOLK_LAZY_TABLE(vkSignalSemaphoreKHR);
+	VOLK_LAZY_TABLE(vkWaitSemaphoresKHR);
+#endif /* defined(VK_KHR_timeline_semaphore) */
+#if defined(VK_KHR_video_decode_queue)
+	VOLK_LAZY_TABLE(vkCmdDecodeVideoKHR);
+#endif /* defined(VK_KHR_video_decode_queue) */
+#if defined(VK_KHR_video_encode_queue)
+	VOLK_LAZY_TABLE(vkCmdEncodeVideoKHR);
+#endif /* defined(VK_KHR_video_encode_queue) */
+#if defined(VK_KHR_video_queue)
+	VOLK_LAZY_TABLE(vkBindVideoSessionMemoryKHR);
+	VOLK_LAZY_TABLE(vkCmdBeginVideoCodingKHR);
+	VOLK_LAZY_TABLE(vkCmdControlVideoCodingKHR);
+	VOLK_LAZY_TABLE(vkCmdEndVideoCodingKHR);
+	VOLK_LAZY_TABLE(vkCreateVideoSessionKHR);
+	VOLK_LAZY_TABLE(vkCreateVideoSessionParametersKHR);
+	VOLK_LAZY_TABLE(vkDestroyVideoSessionKHR);
+	VOLK_LAZY_TABLE(vkDestroyVideoSessionParametersKHR);
+	VOLK_LAZY_TABLE(vkGetVideoSessionMemoryRequirementsKHR);
+	VOLK_LAZY_TABLE(vkUpdateVideoSessionParametersKHR);
+#endif /* defined(VK_KHR_video_queue) */
+#if defined(VK_NVX_binary_import)
+	VOLK_LAZY_TABLE(vkCmdCuLaunchKernelNVX);
+	VOLK_LAZY_TABLE(vkCreateCuFunctionNVX);
+	VOLK_LAZY_TABLE(vkCreateCuModuleNVX);
+	VOLK_LAZY_TABLE(vkDestroyCuFunctionNVX);
+	VOLK_LAZY_TABLE(vkDestroyCuModuleNVX);
+#endif /* defined(VK_NVX_binary_import) */
+#if defined(VK_NVX_image_view_handle)
+	VOLK_LAZY_TABLE(vkGetImageViewAddressNVX);
+	VOLK_LAZY_TABLE(vkGetImageViewHandleNVX);
+#endif /* defined(VK_NVX_image_view_handle) */
+#if defined(VK_NV_clip_space_w_scaling)
+	VOLK_LAZY_TABLE(vkCmdSetViewportWScalingNV);
+#endif /* defined(VK_NV_clip_space_w_scaling) */
+#if defined(VK_NV_device_diagnostic_checkpoints)
+	VOLK_LAZY_TABLE(vkCmdSetCheckpointNV);
+	VOLK_LAZY_TABLE(vkGetQueueCheckpointDataNV);
+#endif /* defined(VK_NV_device_diagnostic_checkpoints) */
+#if defined(VK_NV_device_generated_commands)
+	VOLK_LAZY_TABLE(vkCmdBindPipelineShaderGroupNV);
+	VOLK_LAZY_TABLE(vkCmdExecuteGeneratedCommandsNV);
+	VOLK_LAZY_TABLE(vkCmdPreprocessGeneratedCommandsNV);
+	VOLK_LAZY_TABLE(vkCreateIndirectCommandsLayoutNV);
+	VOLK_LAZY_TABLE(vkDestroyIndirectCommandsLayoutNV);
+	VOLK_LAZY_TABLE(vkGetGeneratedCommandsMemoryRequirementsNV);
+#endif /* defined(VK_NV_device_generated_commands) */
+#if defined(VK_NV_external_memory_rdma)
+	VOLK_LAZY_TABLE(vkGetMemoryRemoteAddressNV);
+#endif /* defined(VK_NV_external_memory_rdma) */
+#if defined(VK_NV_external_memory_win32)
+	VOLK_LAZY_TABLE(vkGetMemoryWin32HandleNV);
+#endif /* defined(VK_NV_external_memory_win32) */
+#if defined(VK_NV_fragment_shading_rate_enums)
+	VOLK_LAZY_TABLE(vkCmdSetFragmentShadingRateEnumNV);
+#endif /* defined(VK_NV_fragment_shading_rate_enums) */
+#if defined(VK_NV_mesh_shader)
+	VOLK_LAZY_TABLE(vkCmdDrawMeshTasksIndirectCountNV);
+	VOLK_LAZY_TABLE(vkCmdDrawMeshTasksIndirectNV);
+	VOLK_LAZY_TABLE(vkCmdDrawMeshTasksNV);
+#endif /* defined(VK_NV_mesh_shader) */
+#if defined(VK_NV_ray_tracing)
+	VOLK_LAZY_TABLE(vkBindAccelerationStructureMemoryNV);
+	VOLK_LAZY_TABLE(vkCmdBuildAccelerationStructureNV);
+	VOLK_LAZY_TABLE(vkCmdCopyAccelerationStructureNV);
+	VOLK_LAZY_TABLE(vkCmdTraceRaysNV);
+	VOLK_LAZY_TABLE(vkCmdWriteAccelerationStructuresPropertiesNV);
+	VOLK_LAZY_TABLE(vkCompileDeferredNV);
+	VOLK_LAZY_TABLE(vkCreateAccelerationStructureNV);
+	VOLK_LAZY_TABLE(vkCreateRayTracingPipelinesNV);
+	VOLK_LAZY_TABLE(vkDestroyAccelerationStructureNV);
+	VOLK_LAZY_TABLE(vkGetAccelerationStructureHandleNV);
+	VOLK_LAZY_TABLE(vkGetAccelerationStructureMemoryRequirementsNV);
+	VOLK_LAZY_TABLE(vkGetRayTracingShaderGroupHandlesNV);
+#endif /* defined(VK_NV_ray_tracing) */
+#if defined(VK_NV_scissor_exclusive)
+	VOLK_LAZY_TABLE(vkCmdSetExclusiveScissorNV);
+#endif /* defined(VK_NV_scissor_exclusive) */
+#if defined(VK_NV_shading_rate_image)
+	VOLK_LAZY_TABLE(vkCmdBindShadingRateImageNV);
+	VOLK_LAZY_TABLE(vkCmdSetCoarseSampleOrderNV);
+	VOLK_LAZY_TABLE(vkCmdSetViewportShadingRatePaletteNV);
+#endif /* defined(VK_NV_shading_rate_image) */
+#if defined(VK_VALVE_descriptor_set_host_mapping)
+	VOLK_LAZY_TABLE(vkGetDescriptorSetHostMappingVALVE);
+	VOLK_LAZY_TABLE(vkGetDescriptorSetLayoutHostMappingInfoVALVE);
+#endif /* defined(VK_VALVE_descriptor_set_host_mapping) */
+#if (defined(VK_EXT_full_screen_exclusive) && defined(VK_KHR_device_group)) || (defined(VK_EXT_full_screen_exclusive) && defined(VK_VERSION_1_1))
+	VOLK_LAZY_TABLE(vkGetDeviceGroupSurfacePresentModes2EXT);
+#endif /* (defined(VK_EXT_full_screen_exclusive) && defined(VK_KHR_device_group)) || (defined(VK_EXT_full_screen_exclusive) && defined(VK_VERSION_1_1)) */
+#if (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor)) || (defined(VK_KHR_push_descriptor) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_push_descriptor) && defined(VK_KHR_descriptor_update_template))
+	VOLK_LAZY_TABLE(vkCmdPushDescriptorSetWithTemplateKHR);
+#endif /* (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor)) || (defined(VK_KHR_push_descriptor) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_push_descriptor) && defined(VK_KHR_descriptor_update_template)) */
+#if (defined(VK_KHR_device_group) && defined(VK_KHR_surface)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1))
+	VOLK_LAZY_TABLE(vkGetDeviceGroupPresentCapabilitiesKHR);
+	VOLK_LAZY_TABLE(vkGetDeviceGroupSurfacePresentModesKHR);
+#endif /* (defined(VK_KHR_device_group) && defined(VK_KHR_surface)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) */
+#if (defined(VK_KHR_device_group) && defined(VK_KHR_swapchain)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1))
+	VOLK_LAZY_TABLE(vkAcquireNextImage2KHR);
+#endif /* (defined(VK_KHR_device_group) && defined(VK_KHR_swapchain)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) */
+	/* VOLK_GENERATE_LAZY_DEVICE_TABLE */
+}
+
+extern "C" {
+
+/* called by volk.c, which owns the loaded instance and device */
+void volkLazyLoadInstance(VkInstance instance, int instanceOnly)
+{
+	lazyInstance = instance;
+	lazyDevice = VK_NULL_HANDLE;
+	volkGenLoadInstanceLazy();
+	if (!instanceOnly)
+		volkGenLoadDeviceLazy();
+}
+
+void volkLazyLoadDevice(VkDevice device)
+{
+	lazyDevice = device;
+	volkGenLoadDeviceLazy();
+}
+
+void volkLoadDeviceTableLazy(struct VolkDeviceTable* table, VkDevice device)
+{
+	{
+		std::lock_guard<std::mutex> lock(lazyTablesLock);
+		void* dispatchKey = getDispatchKey(device);
+		size_t i = 0;
+		while (i < lazyTableCount && lazyTables[i].table != table)
+			++i;
+		/* thunks can only tell devices apart by their dispatch key, which is the driver's loader magic on every
+		 * handle when there is no loader (volkInitializeFromICD)
+		 */
+		for (size_t j = 0; j < lazyTableCount; ++j)
+		{
+			if (j != i && lazyTables[j].dispatchKey == dispatchKey && lazyTables[j].device != device)
+			{
+				fprintf(stderr, "volk: lazy device tables can't tell this device from another, use volkLoadDeviceTable\n");
+				abort();
+			}
+		}
+		if (i == sizeof(lazyTables) / sizeof(lazyTables[0]))
+		{
+			fprintf(stderr, "volk: too many lazy device tables\n");
+			abort();
+		}
+		lazyTables[i] = {dispatchKey, device, table};
+		lazyTableCount = i == lazyTableCount ? lazyTableCount + 1 : lazyTableCount;
+	}
+	volkGenLoadDeviceTableLazy(table);
+}
+
+void volkUnloadDeviceTableLazy(struct VolkDeviceTable* table)
+{
+	std::lock_guard<std::mutex> lock(lazyTablesLock);
+	for (size_t i = 0; i < lazyTableCount; ++i)
+	{
+		if (lazyTables[i].table == table)
+		{
+			lazyTables[i] = lazyTables[--lazyTableCount];
+			return;
+		}
+	}
+}
+
+} // extern "C"